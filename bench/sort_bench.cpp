@@ -0,0 +1,360 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm> // For std::sort, std::stable_sort, std::is_sorted
+#include <chrono>
+#include <cmath>     // For std::pow (Zipf weights)
+#include <cstdint>
+#include <cstdlib>   // For std::strtoull
+#include <cstring>   // For std::strcmp
+#include <iomanip>
+#include <random>
+#include "sorting_algorithmsEx.h"
+#include "generic_sortEx.h"
+
+// --- Sort Benchmark (bin/sort_bench) ---
+//
+// Non-interactive benchmark for the algorithms in sorting_algorithmsEx.cpp.
+// Build with 'make sort_bench' (the sorting module is recompiled with -O2).
+//
+// For every (distribution, size, algorithm) the input is generated once, each
+// run sorts a fresh copy, and only the sort itself is timed. The result is
+// checked to be sorted and to still hold the same multiset of values.
+//
+// Usage: bin/sort_bench [options]
+//   --min-size N     smallest input size            (default 100)
+//   --max-size N     largest input size, x10 steps  (default 1000000, up to 10^8)
+//   --reps N         timed runs per case            (default 5)
+//   --warmup N       untimed runs per case          (default 1)
+//   --algos a,b,...  only these algorithms          (default all)
+//   --dists a,b,...  only these distributions       (default all)
+//   --csv FILE       also write the results as CSV
+//   --json FILE      also write the results as JSON
+//   --stats          also count comparisons, moves and max recursion depth
+//                    (one extra untimed run of the instrumented build of the
+//                    algorithms that have one, see sort_instrumentationEx.h)
+
+struct BenchOptions {
+    uint64_t minSize = 100;
+    uint64_t maxSize = 1000000;
+    int reps = 5;
+    int warmup = 1;
+    std::vector<std::string> algos;
+    std::vector<std::string> dists;
+    std::string csvPath;
+    std::string jsonPath;
+    bool stats = false;
+};
+
+struct BenchAlgorithm {
+    const char* name;
+    uint64_t maxSize; // quadratic / unguarded sorts are skipped above this size
+    void (*sort)(std::vector<int>&);
+    SortStats (*counted)(std::vector<int>&); // instrumented build, or nullptr
+};
+
+struct BenchResult {
+    std::string distribution;
+    std::string algorithm;
+    uint64_t size;
+    int reps;
+    double medianNsPerElement;
+    double p95NsPerElement;
+    bool correct;
+    bool hasStats;
+    SortStats stats;
+};
+
+static int lastIndex(const std::vector<int>& v) {
+    return static_cast<int>(v.size()) - 1;
+}
+
+// bubbleSort/selectionSort are O(n^2); quickSort/quickSortHoare have no depth
+// guard and recurse O(n) deep on sorted or organ-pipe input.
+const uint64_t QUADRATIC_MAX_SIZE = 10000;
+
+static const BenchAlgorithm ALGORITHMS[] = {
+    {"bubbleSort", QUADRATIC_MAX_SIZE, [](std::vector<int>& v) { bubbleSort(v); }, nullptr},
+    {"selectionSort", QUADRATIC_MAX_SIZE, [](std::vector<int>& v) { selectionSort(v); }, nullptr},
+    {"quickSort", QUADRATIC_MAX_SIZE, [](std::vector<int>& v) { quickSort(v, 0, lastIndex(v)); }, quickSortCounted},
+    {"quickSortHoare", QUADRATIC_MAX_SIZE, [](std::vector<int>& v) { quickSortHoare(v, 0, lastIndex(v)); }, quickSortHoareCounted},
+    {"introSort", UINT64_MAX, [](std::vector<int>& v) { introSort(v); }, introSortCounted},
+    {"pdqSort", UINT64_MAX, [](std::vector<int>& v) { pdqSort(v, 0, lastIndex(v)); }, nullptr},
+    {"dualPivotQuickSort", UINT64_MAX, [](std::vector<int>& v) { dualPivotQuickSort(v, 0, lastIndex(v)); }, nullptr},
+    {"radixSort", UINT64_MAX, [](std::vector<int>& v) { radixSort(v); }, nullptr},
+    {"parallelSampleSort", UINT64_MAX, [](std::vector<int>& v) { parallelSampleSort(v); }, nullptr},
+    {"timSort", UINT64_MAX, [](std::vector<int>& v) { timSort(v); }, timSortCounted},
+    {"sortRange", UINT64_MAX, [](std::vector<int>& v) { sortRange(v.begin(), v.end()); }, nullptr},
+    {"std::sort", UINT64_MAX, [](std::vector<int>& v) { std::sort(v.begin(), v.end()); }, nullptr},
+    {"std::stable_sort", UINT64_MAX, [](std::vector<int>& v) { std::stable_sort(v.begin(), v.end()); }, nullptr},
+};
+
+static const char* const DISTRIBUTIONS[] = {"random", "sorted", "reversed", "organ-pipe",
+                                            "few-unique", "sawtooth", "zipf"};
+
+const uint32_t ZIPF_UNIVERSE = 1 << 20; // distinct values for the Zipf distribution
+const double ZIPF_EXPONENT = 1.0;
+
+/**
+ * @brief Fills a vector of size n with the named distribution (fixed seed).
+ */
+static std::vector<int> generateInput(const std::string& dist, uint64_t n) {
+    std::vector<int> v(n);
+    std::mt19937_64 rng(42);
+
+    if (dist == "random") {
+        for (int& x : v) x = static_cast<int>(rng());
+    } else if (dist == "sorted") {
+        for (uint64_t i = 0; i < n; ++i) v[i] = static_cast<int>(i);
+    } else if (dist == "reversed") {
+        for (uint64_t i = 0; i < n; ++i) v[i] = static_cast<int>(n - i);
+    } else if (dist == "organ-pipe") {
+        // Ascending first half, descending second half.
+        for (uint64_t i = 0; i < n; ++i) v[i] = static_cast<int>(i < n / 2 ? i : n - i);
+    } else if (dist == "few-unique") {
+        for (int& x : v) x = static_cast<int>(rng() % 16);
+    } else if (dist == "sawtooth") {
+        // 32 ascending runs.
+        uint64_t period = std::max<uint64_t>(n / 32, 1);
+        for (uint64_t i = 0; i < n; ++i) v[i] = static_cast<int>(i % period);
+    } else if (dist == "zipf") {
+        // Value k is drawn with probability proportional to 1 / k^s (inverse CDF).
+        std::vector<double> cdf(ZIPF_UNIVERSE);
+        double total = 0.0;
+        for (uint32_t k = 0; k < ZIPF_UNIVERSE; ++k) {
+            total += 1.0 / std::pow(static_cast<double>(k + 1), ZIPF_EXPONENT);
+            cdf[k] = total;
+        }
+        std::uniform_real_distribution<double> uniform(0.0, total);
+        for (int& x : v) {
+            x = static_cast<int>(std::upper_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+        }
+    }
+    return v;
+}
+
+/**
+ * @brief Order-independent fingerprint of the values, to catch lost or duplicated elements.
+ */
+static uint64_t multisetChecksum(const std::vector<int>& v) {
+    uint64_t sum = 0;
+    for (int x : v) {
+        uint64_t h = static_cast<uint32_t>(x) * 0x9E3779B97F4A7C15ull;
+        sum += h ^ (h >> 29);
+    }
+    return sum;
+}
+
+/**
+ * @brief Nearest-rank percentile of an already sorted sample.
+ */
+static double percentile(const std::vector<double>& sortedSamples, double p) {
+    size_t rank = static_cast<size_t>(std::ceil(p * sortedSamples.size()));
+    return sortedSamples[std::max<size_t>(rank, 1) - 1];
+}
+
+static BenchResult runCase(const BenchAlgorithm& algo, const std::string& dist,
+                           const std::vector<int>& input, uint64_t inputChecksum, const BenchOptions& options) {
+    std::vector<int> work;
+    std::vector<double> samples;
+    bool correct = true;
+
+    for (int run = 0; run < options.warmup + options.reps; ++run) {
+        work = input;
+        auto start = std::chrono::steady_clock::now();
+        algo.sort(work);
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        if (!std::is_sorted(work.begin(), work.end()) || multisetChecksum(work) != inputChecksum) {
+            correct = false;
+        }
+        if (run >= options.warmup) {
+            samples.push_back(ns / static_cast<double>(input.size()));
+        }
+    }
+
+    SortStats stats;
+    bool hasStats = options.stats && algo.counted != nullptr;
+    if (hasStats) {
+        work = input;
+        stats = algo.counted(work);
+        if (!std::is_sorted(work.begin(), work.end())) correct = false;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    return {dist,     algo.name, input.size(), options.reps, percentile(samples, 0.5), percentile(samples, 0.95),
+            correct, hasStats,  stats};
+}
+
+static std::vector<std::string> splitList(const char* arg) {
+    std::vector<std::string> items;
+    std::string current;
+    for (const char* p = arg; *p != '\0'; ++p) {
+        if (*p == ',') {
+            if (!current.empty()) items.push_back(current);
+            current.clear();
+        } else {
+            current += *p;
+        }
+    }
+    if (!current.empty()) items.push_back(current);
+    return items;
+}
+
+static bool contains(const std::vector<std::string>& list, const std::string& name) {
+    return list.empty() || std::find(list.begin(), list.end(), name) != list.end();
+}
+
+static void printUsage() {
+    std::cout << "Usage: sort_bench [--min-size N] [--max-size N] [--reps N] [--warmup N]\n"
+              << "                  [--algos a,b,...] [--dists a,b,...] [--csv FILE] [--json FILE] [--stats]\n"
+              << "Algorithms:";
+    for (const BenchAlgorithm& algo : ALGORITHMS) std::cout << " " << algo.name;
+    std::cout << "\nDistributions:";
+    for (const char* dist : DISTRIBUTIONS) std::cout << " " << dist;
+    std::cout << "\n";
+}
+
+static bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0) {
+            printUsage();
+            return false;
+        }
+        if (std::strcmp(arg, "--stats") == 0) {
+            options.stats = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Error: missing value for " << arg << std::endl;
+            return false;
+        }
+        const char* value = argv[++i];
+        if (std::strcmp(arg, "--min-size") == 0) {
+            options.minSize = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--max-size") == 0) {
+            options.maxSize = std::strtoull(value, nullptr, 10);
+        } else if (std::strcmp(arg, "--reps") == 0) {
+            options.reps = std::atoi(value);
+        } else if (std::strcmp(arg, "--warmup") == 0) {
+            options.warmup = std::atoi(value);
+        } else if (std::strcmp(arg, "--algos") == 0) {
+            options.algos = splitList(value);
+        } else if (std::strcmp(arg, "--dists") == 0) {
+            options.dists = splitList(value);
+        } else if (std::strcmp(arg, "--csv") == 0) {
+            options.csvPath = value;
+        } else if (std::strcmp(arg, "--json") == 0) {
+            options.jsonPath = value;
+        } else {
+            std::cerr << "Error: unknown option " << arg << std::endl;
+            printUsage();
+            return false;
+        }
+    }
+
+    if (options.minSize == 0 || options.maxSize < options.minSize || options.reps < 1 || options.warmup < 0) {
+        std::cerr << "Error: need 0 < min-size <= max-size, reps >= 1 and warmup >= 0." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static bool writeCsv(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error: could not open " << path << " for writing." << std::endl;
+        return false;
+    }
+    out << "distribution,algorithm,size,reps,median_ns_per_element,p95_ns_per_element,correct,"
+        << "comparisons,moves,max_depth\n";
+    for (const BenchResult& r : results) {
+        out << r.distribution << "," << r.algorithm << "," << r.size << "," << r.reps << ","
+            << r.medianNsPerElement << "," << r.p95NsPerElement << "," << (r.correct ? "true" : "false");
+        if (r.hasStats) {
+            out << "," << r.stats.comparisons << "," << r.stats.moves << "," << r.stats.maxDepth << "\n";
+        } else {
+            out << ",,,\n"; // not measured
+        }
+    }
+    return true;
+}
+
+static bool writeJson(const std::string& path, const std::vector<BenchResult>& results) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        std::cerr << "Error: could not open " << path << " for writing." << std::endl;
+        return false;
+    }
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        out << "  {\"distribution\": \"" << r.distribution << "\", \"algorithm\": \"" << r.algorithm
+            << "\", \"size\": " << r.size << ", \"reps\": " << r.reps
+            << ", \"median_ns_per_element\": " << r.medianNsPerElement
+            << ", \"p95_ns_per_element\": " << r.p95NsPerElement
+            << ", \"correct\": " << (r.correct ? "true" : "false");
+        if (r.hasStats) {
+            out << ", \"comparisons\": " << r.stats.comparisons << ", \"moves\": " << r.stats.moves
+                << ", \"max_depth\": " << r.stats.maxDepth;
+        }
+        out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<BenchResult> results;
+    bool allCorrect = true;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::left << std::setw(14) << "distribution" << std::setw(20) << "algorithm" << std::right
+              << std::setw(11) << "size" << std::setw(12) << "median ns" << std::setw(10) << "p95 ns" << "  ok";
+    if (options.stats) {
+        std::cout << "  compares/n   moves/n  depth";
+    }
+    std::cout << "\n";
+
+    for (const char* dist : DISTRIBUTIONS) {
+        if (!contains(options.dists, dist)) continue;
+
+        for (uint64_t n = options.minSize; n <= options.maxSize; n *= 10) {
+            std::vector<int> input = generateInput(dist, n);
+            uint64_t checksum = multisetChecksum(input);
+
+            for (const BenchAlgorithm& algo : ALGORITHMS) {
+                if (!contains(options.algos, algo.name) || n > algo.maxSize) continue;
+
+                BenchResult r = runCase(algo, dist, input, checksum, options);
+                allCorrect = allCorrect && r.correct;
+                results.push_back(r);
+                std::cout << std::left << std::setw(14) << r.distribution << std::setw(20) << r.algorithm
+                          << std::right << std::setw(11) << r.size << std::setw(12) << r.medianNsPerElement
+                          << std::setw(10) << r.p95NsPerElement << "  " << (r.correct ? "yes" : "NO ");
+                if (r.hasStats) {
+                    std::cout << std::setw(12) << static_cast<double>(r.stats.comparisons) / n << std::setw(10)
+                              << static_cast<double>(r.stats.moves) / n << std::setw(7) << r.stats.maxDepth;
+                }
+                std::cout << std::endl;
+            }
+            if (n > options.maxSize / 10) break; // avoid overflow past max-size
+        }
+    }
+
+    if (!options.csvPath.empty() && !writeCsv(options.csvPath, results)) return 1;
+    if (!options.jsonPath.empty() && !writeJson(options.jsonPath, results)) return 1;
+
+    if (!allCorrect) {
+        std::cerr << "Error: at least one algorithm produced a wrong result." << std::endl;
+        return 2;
+    }
+    return 0;
+}
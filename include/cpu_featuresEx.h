@@ -0,0 +1,49 @@
+#ifndef CPU_FEATURESEX_H
+#define CPU_FEATURESEX_H
+
+// Runtime CPU feature detection.
+// SIMD code paths are compiled with per-function target attributes, so one
+// binary runs everywhere: callers check cpuHasAVX2()/cpuHasSSE41() once and
+// pick the fastest implementation the current CPU supports.
+// On non-x86 targets (or MSVC) SIMD_X86 is 0 and only the scalar code is used.
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SIMD_X86 1
+#define TARGET_AVX2  __attribute__((target("avx2")))
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#include <immintrin.h>
+#else
+#define SIMD_X86 0
+#endif
+
+inline bool cpuHasAVX2() {
+#if SIMD_X86
+    static const bool has = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return has;
+#else
+    return false;
+#endif
+}
+
+inline bool cpuHasSSE41() {
+#if SIMD_X86
+    static const bool has = (__builtin_cpu_init(), __builtin_cpu_supports("sse4.1") != 0);
+    return has;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Hints the CPU to start loading the cache line that holds 'address'.
+ * A prefetch never faults, so the address may lie past the end of an array.
+ */
+inline void prefetchRead(const void* address) {
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+#endif // CPU_FEATURESEX_H
@@ -0,0 +1,603 @@
+#ifndef GENERIC_SORTEX_H
+#define GENERIC_SORTEX_H
+
+// Header-only generic sorting API.
+//
+// The functions in sorting_algorithmsEx.cpp only take std::vector<int>&.
+// These templates work on any random-access range (Task, Student, Vector2D, ...)
+// and take either a comparator or a projection (key extractor):
+//
+//   sortRange(first, last)              - ascending, radix sort for integral values
+//   sortRange(first, last, comp)        - comparison sort (introsort) with comp
+//   sortBy(first, last, key)            - ascending by key(element)
+//   argsort(first, last, comp)          - permutation p with first[p[0]] <= first[p[1]] <= ...
+//   argsortBy(first, last, key)         - same, ordered by key(element)
+//   stableSortRange(first, last, comp)  - stable, adaptive (Timsort)
+//   stableSortBy(first, last, key)      - stable, adaptive, by key(element)
+//
+// sortRange(first, last, comp) and stableSortRange(first, last, comp) also take
+// an instrumentation policy (see sort_instrumentationEx.h), e.g.
+//   sortRange<CountingSortInstrumentation>(first, last, comp)
+//
+// The algorithm is chosen at compile time: integral keys (int, long, char, ...)
+// use an LSD radix sort, every other key type uses introsort.
+// 'key' may be a lambda or a pointer to member, e.g. sortBy(b, e, &Task::priority).
+// argsort/argsortBy never move the records, and ties keep their original order.
+
+#include <vector>
+#include <algorithm>   // For std::iter_swap, std::move (range)
+#include <iterator>    // For std::iterator_traits, std::make_reverse_iterator
+#include <functional>  // For std::less, std::invoke
+#include <type_traits> // For std::is_integral, std::make_unsigned
+#include <utility>     // For std::move, std::pair
+#include <cstddef>
+#include "sort_instrumentationEx.h"
+
+// --- Introsort (comparison path) ---
+
+const std::ptrdiff_t GENERIC_INSERTION_THRESHOLD = 16;
+const size_t GENERIC_RADIX_MIN_SIZE = 64; // below this insertion sort is faster
+
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void genericInsertionSort(RandomIt first, RandomIt last, Compare comp) {
+    if (first == last) return;
+    for (RandomIt i = first + 1; i != last; ++i) {
+        auto value = std::move(*i);
+        RandomIt j = i;
+        while (j != first && comp(value, *(j - 1))) {
+            *j = std::move(*(j - 1));
+            --j;
+        }
+        *j = std::move(value);
+        Instr::move(static_cast<uint64_t>(i - j) + 2);
+    }
+}
+
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void genericSiftDown(RandomIt base, std::ptrdiff_t n, std::ptrdiff_t root, Compare comp) {
+    auto value = std::move(base[root]);
+    Instr::move(2);
+    while (true) {
+        std::ptrdiff_t child = 2 * root + 1;
+        if (child >= n) break;
+        if (child + 1 < n && comp(base[child], base[child + 1])) {
+            ++child;
+        }
+        if (!comp(value, base[child])) break;
+        base[root] = std::move(base[child]);
+        Instr::move();
+        root = child;
+    }
+    base[root] = std::move(value);
+}
+
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void genericHeapSort(RandomIt first, RandomIt last, Compare comp) {
+    std::ptrdiff_t n = last - first;
+    for (std::ptrdiff_t i = n / 2 - 1; i >= 0; --i) {
+        genericSiftDown<Instr>(first, n, i, comp);
+    }
+    for (std::ptrdiff_t end = n - 1; end > 0; --end) {
+        std::iter_swap(first, first + end);
+        Instr::swap();
+        genericSiftDown<Instr>(first, end, 0, comp);
+    }
+}
+
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void genericSort3(RandomIt a, RandomIt b, RandomIt c, Compare comp) {
+    if (comp(*b, *a)) { std::iter_swap(a, b); Instr::swap(); }
+    if (comp(*c, *b)) { std::iter_swap(b, c); Instr::swap(); }
+    if (comp(*b, *a)) { std::iter_swap(a, b); Instr::swap(); }
+}
+
+/**
+ * @brief Median-of-three pivot moved to *first, then a Hoare-style partition.
+ * @return Iterator to the pivot's final position.
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+RandomIt genericPartition(RandomIt first, RandomIt last, Compare comp) {
+    RandomIt mid = first + (last - first) / 2;
+    genericSort3<Instr>(first, mid, last - 1, comp);
+    std::iter_swap(first, mid);
+    Instr::swap();
+
+    RandomIt i = first + 1;
+    RandomIt j = last - 1;
+    while (true) {
+        while (i <= j && comp(*i, *first)) ++i;
+        while (comp(*first, *j)) --j; // *first itself stops this scan
+        if (i >= j) break;
+        std::iter_swap(i, j);
+        Instr::swap();
+        ++i;
+        --j;
+    }
+    std::iter_swap(first, j);
+    Instr::swap();
+    return j;
+}
+
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void genericIntroSortLoop(RandomIt first, RandomIt last, int depthLimit, Compare comp) {
+    SortDepthScope<Instr> depth;
+    while (last - first > GENERIC_INSERTION_THRESHOLD) {
+        if (depthLimit == 0) {
+            genericHeapSort<Instr>(first, last, comp);
+            return;
+        }
+        --depthLimit;
+        RandomIt p = genericPartition<Instr>(first, last, comp);
+        // Recurse into the smaller half, loop on the larger one.
+        if (p - first < last - (p + 1)) {
+            genericIntroSortLoop<Instr>(first, p, depthLimit, comp);
+            first = p + 1;
+        } else {
+            genericIntroSortLoop<Instr>(p + 1, last, depthLimit, comp);
+            last = p;
+        }
+    }
+    genericInsertionSort<Instr>(first, last, comp);
+}
+
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void genericIntroSort(RandomIt first, RandomIt last, Compare comp) {
+    int depthLimit = 0;
+    for (std::ptrdiff_t n = last - first; n > 1; n >>= 1) {
+        depthLimit += 2; // 2 * floor(log2(n))
+    }
+    if constexpr (Instr::enabled) {
+        genericIntroSortLoop<Instr>(first, last, depthLimit, CountingCompare<Instr, Compare>{comp});
+    } else {
+        genericIntroSortLoop(first, last, depthLimit, comp);
+    }
+}
+
+// --- LSD radix sort (integral-key path) ---
+
+// True for key types that take the radix path. bool has no unsigned counterpart
+// and gains nothing from radix sort, so it is excluded.
+template <typename Key>
+struct IsRadixKey
+    : std::integral_constant<bool, std::is_integral<Key>::value && !std::is_same<Key, bool>::value> {};
+
+/**
+ * @brief Maps an integral key to an unsigned key with the same ordering
+ * (the sign bit of signed types is flipped so negatives sort first).
+ */
+template <typename Key>
+typename std::make_unsigned<Key>::type toRadixKey(Key key) {
+    typedef typename std::make_unsigned<Key>::type UKey;
+    UKey u = static_cast<UKey>(key);
+    if (std::is_signed<Key>::value) {
+        u ^= static_cast<UKey>(UKey(1) << (sizeof(UKey) * 8 - 1));
+    }
+    return u;
+}
+
+/**
+ * @brief Stable LSD radix sort (8-bit digits) of data[0..n) by getKey(element),
+ * which must return an unsigned integer. Digits that are equal for every
+ * element are skipped.
+ */
+template <typename T, typename GetKey>
+void genericRadixSort(std::vector<T>& data, GetKey getKey) {
+    typedef decltype(getKey(data[0])) UKey;
+    const int passes = static_cast<int>(sizeof(UKey));
+    size_t n = data.size();
+    if (n == 0) return;
+
+    std::vector<size_t> counts(passes * 256, 0);
+    for (size_t i = 0; i < n; ++i) {
+        UKey key = getKey(data[i]);
+        for (int p = 0; p < passes; ++p) {
+            counts[p * 256 + ((key >> (8 * p)) & 0xFF)]++;
+        }
+    }
+
+    std::vector<T> scratch(n);
+    T* src = data.data();
+    T* dst = scratch.data();
+    for (int p = 0; p < passes; ++p) {
+        size_t* h = counts.data() + p * 256;
+        if (h[(getKey(src[0]) >> (8 * p)) & 0xFF] == n) {
+            continue; // Same digit everywhere: nothing to do for this pass.
+        }
+        size_t sum = 0;
+        for (int b = 0; b < 256; ++b) {
+            size_t count = h[b];
+            h[b] = sum;
+            sum += count;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            dst[h[(getKey(src[i]) >> (8 * p)) & 0xFF]++] = std::move(src[i]);
+        }
+        std::swap(src, dst);
+    }
+    if (src != data.data()) {
+        for (size_t i = 0; i < n; ++i) data[i] = std::move(src[i]);
+    }
+}
+
+// --- Public API ---
+
+/**
+ * @brief Returns the permutation that sorts [first, last) by key(element).
+ * Ties keep their original order (stable). The range itself is not modified.
+ */
+template <typename RandomIt, typename KeyFn>
+std::vector<size_t> argsortBy(RandomIt first, RandomIt last, KeyFn key) {
+    typedef typename std::decay<decltype(std::invoke(key, *first))>::type Key;
+    size_t n = static_cast<size_t>(last - first);
+    std::vector<size_t> order(n);
+
+    if constexpr (IsRadixKey<Key>::value) {
+        typedef typename std::make_unsigned<Key>::type UKey;
+        std::vector<std::pair<UKey, size_t>> items(n);
+        for (size_t i = 0; i < n; ++i) {
+            items[i] = std::make_pair(toRadixKey(std::invoke(key, first[i])), i);
+        }
+        if (n < GENERIC_RADIX_MIN_SIZE) {
+            genericInsertionSort(items.begin(), items.end(),
+                                 [](const std::pair<UKey, size_t>& a, const std::pair<UKey, size_t>& b) {
+                                     return a.first < b.first;
+                                 });
+        } else if (n > 0) {
+            genericRadixSort(items, [](const std::pair<UKey, size_t>& item) { return item.first; });
+        }
+        for (size_t i = 0; i < n; ++i) order[i] = items[i].second;
+    } else {
+        for (size_t i = 0; i < n; ++i) order[i] = i;
+        // Break ties by position so the result is stable and deterministic.
+        genericIntroSort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            const auto& ka = std::invoke(key, first[a]);
+            const auto& kb = std::invoke(key, first[b]);
+            if (ka < kb) return true;
+            if (kb < ka) return false;
+            return a < b;
+        });
+    }
+    return order;
+}
+
+/**
+ * @brief Returns the permutation that sorts [first, last) by comp.
+ * Ties keep their original order (stable). The range itself is not modified.
+ */
+template <typename RandomIt, typename Compare>
+std::vector<size_t> argsort(RandomIt first, RandomIt last, Compare comp) {
+    size_t n = static_cast<size_t>(last - first);
+    std::vector<size_t> order(n);
+    for (size_t i = 0; i < n; ++i) order[i] = i;
+    genericIntroSort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        if (comp(first[a], first[b])) return true;
+        if (comp(first[b], first[a])) return false;
+        return a < b;
+    });
+    return order;
+}
+
+/**
+ * @brief Sorts [first, last) ascending by key(element).
+ * Integral keys: stable radix sort on (key, index) pairs, then each record is
+ * moved exactly twice. Other keys: introsort comparing key(a) < key(b).
+ */
+template <typename RandomIt, typename KeyFn>
+void sortBy(RandomIt first, RandomIt last, KeyFn key) {
+    typedef typename std::decay<decltype(std::invoke(key, *first))>::type Key;
+    typedef typename std::iterator_traits<RandomIt>::value_type Value;
+
+    if constexpr (IsRadixKey<Key>::value) {
+        std::vector<size_t> order = argsortBy(first, last, key);
+        std::vector<Value> sorted;
+        sorted.reserve(order.size());
+        for (size_t index : order) sorted.push_back(std::move(first[index]));
+        for (size_t i = 0; i < order.size(); ++i) first[i] = std::move(sorted[i]);
+    } else {
+        genericIntroSort(first, last, [&](const Value& a, const Value& b) {
+            return std::invoke(key, a) < std::invoke(key, b);
+        });
+    }
+}
+
+/**
+ * @brief Sorts [first, last) with a custom comparator (introsort).
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void sortRange(RandomIt first, RandomIt last, Compare comp) {
+    genericIntroSort<Instr>(first, last, comp);
+}
+
+/**
+ * @brief Sorts [first, last) ascending. Integral values use radix sort directly.
+ */
+template <typename RandomIt>
+void sortRange(RandomIt first, RandomIt last) {
+    typedef typename std::iterator_traits<RandomIt>::value_type Value;
+
+    if constexpr (IsRadixKey<Value>::value) {
+        if (static_cast<size_t>(last - first) < GENERIC_RADIX_MIN_SIZE) {
+            genericInsertionSort(first, last, std::less<Value>());
+            return;
+        }
+        std::vector<Value> values(first, last);
+        genericRadixSort(values, [](Value v) { return toRadixKey(v); });
+        std::move(values.begin(), values.end(), first);
+    } else {
+        genericIntroSort(first, last, std::less<Value>());
+    }
+}
+
+// --- Timsort-style adaptive merge sort (stable path) ---
+//
+// Real data is often almost sorted: logs that are mostly appended, task lists
+// re-sorted after a small edit. A natural merge sort takes advantage of that:
+// 1. Scan for runs that are already ascending (or strictly descending, which
+//    are reversed in place). Short runs are extended to 'minRun' elements with
+//    binary insertion sort.
+// 2. Keep the runs on a stack and merge neighbours while their lengths break
+//    the Timsort invariants, so merges stay balanced.
+// 3. Merges start in one-at-a-time mode; when one run keeps winning they
+//    switch to galloping (exponential + binary search) and move whole blocks.
+// Sorted input is a single run: n - 1 comparisons and no moves.
+
+const std::ptrdiff_t TIMSORT_MIN_MERGE = 64;  // below this: binary insertion sort only
+const int TIMSORT_MIN_GALLOP = 7;
+
+/**
+ * @brief Length of the run starting at 'first'. A strictly descending run is
+ * reversed so that every run is ascending (strictness keeps the sort stable).
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+std::ptrdiff_t timCountRun(RandomIt first, RandomIt last, Compare comp) {
+    RandomIt run = first + 1;
+    if (run == last) return 1;
+    if (comp(*run, *first)) {
+        while (++run != last && comp(*run, *(run - 1))) {}
+        std::reverse(first, run);
+        Instr::move(3 * static_cast<uint64_t>((run - first) / 2));
+    } else {
+        while (++run != last && !comp(*run, *(run - 1))) {}
+    }
+    return run - first;
+}
+
+/**
+ * @brief Binary insertion sort of [first, last) where [first, start) is already sorted.
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void timBinaryInsertionSort(RandomIt first, RandomIt last, RandomIt start, Compare comp) {
+    for (RandomIt i = start; i < last; ++i) {
+        auto value = std::move(*i);
+        RandomIt pos = std::upper_bound(first, i, value, comp); // after equal keys: stable
+        std::move_backward(pos, i, i + 1);
+        *pos = std::move(value);
+        Instr::move(static_cast<uint64_t>(i - pos) + 2);
+    }
+}
+
+/**
+ * @brief Picks minRun in [32, 64] so that n / minRun is a power of two or just below.
+ */
+inline std::ptrdiff_t timMinRunLength(std::ptrdiff_t n) {
+    std::ptrdiff_t r = 0;
+    while (n >= TIMSORT_MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/**
+ * @brief Galloping search: number of leading elements of base[0..len) that are <= key.
+ * Probes 1, 3, 7, 15, ... then binary-searches the last gap.
+ */
+template <typename RandomIt, typename T, typename Compare>
+std::ptrdiff_t timGallopUpper(const T& key, RandomIt base, std::ptrdiff_t len, Compare comp) {
+    std::ptrdiff_t lo = 0;
+    std::ptrdiff_t hi = 1;
+    while (hi <= len && !comp(key, base[hi - 1])) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    return std::upper_bound(base + lo, base + std::min(hi, len), key, comp) - base;
+}
+
+/**
+ * @brief Galloping search: number of leading elements of base[0..len) that are < key.
+ */
+template <typename RandomIt, typename T, typename Compare>
+std::ptrdiff_t timGallopLower(const T& key, RandomIt base, std::ptrdiff_t len, Compare comp) {
+    std::ptrdiff_t lo = 0;
+    std::ptrdiff_t hi = 1;
+    while (hi <= len && comp(base[hi - 1], key)) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    return std::lower_bound(base + lo, base + std::min(hi, len), key, comp) - base;
+}
+
+/**
+ * @brief Stable merge of [first, mid) and [mid, last), left to right.
+ * The left run is moved to 'buffer'; on ties the left run wins (stability).
+ * Merging right to left is the same algorithm on reverse iterators with the
+ * comparator's arguments swapped (see timMergeAt).
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Buffer, typename Compare>
+void timMergeLo(RandomIt first, RandomIt mid, RandomIt last, Buffer& buffer, int& minGallop, Compare comp) {
+    buffer.assign(std::make_move_iterator(first), std::make_move_iterator(mid));
+    // Every element of the left run is moved out and back in; each one taken
+    // from the right run moves once.
+    Instr::move(2 * static_cast<uint64_t>(mid - first));
+    RandomIt rightStart = mid;
+    auto cursor1 = buffer.begin();
+    auto end1 = buffer.end();
+    RandomIt cursor2 = mid;
+    RandomIt dest = first;
+
+    while (cursor1 != end1 && cursor2 != last) {
+        // One-at-a-time mode until one run wins minGallop times in a row.
+        int count1 = 0;
+        int count2 = 0;
+        while (cursor1 != end1 && cursor2 != last && (count1 | count2) < minGallop) {
+            if (comp(*cursor2, *cursor1)) {
+                *dest++ = std::move(*cursor2++);
+                ++count2;
+                count1 = 0;
+            } else {
+                *dest++ = std::move(*cursor1++);
+                ++count1;
+                count2 = 0;
+            }
+        }
+
+        // Galloping mode: move whole blocks while it keeps paying off.
+        while (cursor1 != end1 && cursor2 != last) {
+            std::ptrdiff_t block1 = timGallopUpper(*cursor2, cursor1, end1 - cursor1, comp);
+            dest = std::move(cursor1, cursor1 + block1, dest);
+            cursor1 += block1;
+            if (cursor1 == end1) break;
+            *dest++ = std::move(*cursor2++);
+            if (cursor2 == last) break;
+
+            std::ptrdiff_t block2 = timGallopLower(*cursor1, cursor2, last - cursor2, comp);
+            dest = std::move(cursor2, cursor2 + block2, dest);
+            cursor2 += block2;
+            if (cursor2 == last) break;
+            *dest++ = std::move(*cursor1++);
+
+            if (minGallop > 1) --minGallop; // Galloping works: make it easier to enter.
+            if (block1 < TIMSORT_MIN_GALLOP && block2 < TIMSORT_MIN_GALLOP) {
+                minGallop += 2;             // It stopped paying off: penalize re-entry.
+                break;
+            }
+        }
+    }
+    // Whatever is left of the left run goes last; the right run is already in place.
+    std::move(cursor1, end1, dest);
+    Instr::move(static_cast<uint64_t>(cursor2 - rightStart));
+}
+
+/**
+ * @brief Merges the adjacent runs [first, mid) and [mid, last).
+ * Elements already in their final place are trimmed off with two gallops, and
+ * the smaller remaining run is the one copied into the buffer.
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Buffer, typename Compare>
+void timMergeAt(RandomIt first, RandomIt mid, RandomIt last, Buffer& buffer, int& minGallop, Compare comp) {
+    // Elements of the left run <= *mid are already in place.
+    first += timGallopUpper(*mid, first, mid - first, comp);
+    if (first == mid) return;
+    // Elements of the right run >= the left run's last element are already in place.
+    last = mid + timGallopLower(*(mid - 1), mid, last - mid, comp);
+    if (mid == last) return;
+
+    if (mid - first <= last - mid) {
+        timMergeLo<Instr>(first, mid, last, buffer, minGallop, comp);
+    } else {
+        auto reversedComp = [&comp](const auto& a, const auto& b) { return comp(b, a); };
+        timMergeLo<Instr>(std::make_reverse_iterator(last), std::make_reverse_iterator(mid),
+                   std::make_reverse_iterator(first), buffer, minGallop, reversedComp);
+    }
+}
+
+/**
+ * @brief Timsort main loop. Counts one depth level per run waiting on the stack.
+ */
+template <typename Instr, typename RandomIt, typename Compare>
+void timSortRuns(RandomIt first, RandomIt last, Compare comp) {
+    typedef typename std::iterator_traits<RandomIt>::value_type Value;
+    std::ptrdiff_t n = last - first;
+    if (n < 2) return;
+
+    if (n < TIMSORT_MIN_MERGE) {
+        std::ptrdiff_t runLen = timCountRun<Instr>(first, last, comp);
+        timBinaryInsertionSort<Instr>(first, last, first + runLen, comp);
+        return;
+    }
+
+    std::ptrdiff_t minRun = timMinRunLength(n);
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> runs; // (start, length)
+    std::vector<Value> buffer;
+    int minGallop = TIMSORT_MIN_GALLOP;
+
+    auto mergeRunAt = [&](size_t i) {
+        RandomIt runFirst = first + runs[i].first;
+        RandomIt runMid = runFirst + runs[i].second;
+        RandomIt runLast = runMid + runs[i + 1].second;
+        runs[i].second += runs[i + 1].second;
+        runs.erase(runs.begin() + static_cast<std::ptrdiff_t>(i) + 1);
+        Instr::leave();
+        timMergeAt<Instr>(runFirst, runMid, runLast, buffer, minGallop, comp);
+    };
+
+    std::ptrdiff_t lo = 0;
+    while (lo < n) {
+        // 1. Find the next run, extending short ones to minRun.
+        std::ptrdiff_t runLen = timCountRun<Instr>(first + lo, last, comp);
+        if (runLen < minRun) {
+            std::ptrdiff_t forced = std::min(minRun, n - lo);
+            timBinaryInsertionSort<Instr>(first + lo, first + lo + forced, first + lo + runLen, comp);
+            runLen = forced;
+        }
+        runs.push_back(std::make_pair(lo, runLen));
+        Instr::enter();
+        lo += runLen;
+
+        // 2. Restore the stack invariants: len[i-2] > len[i-1] + len[i] and len[i-1] > len[i].
+        while (runs.size() > 1) {
+            size_t i = runs.size() - 2;
+            if ((i > 0 && runs[i - 1].second <= runs[i].second + runs[i + 1].second) ||
+                (i > 1 && runs[i - 2].second <= runs[i - 1].second + runs[i].second)) {
+                if (runs[i - 1].second < runs[i + 1].second) --i;
+                mergeRunAt(i);
+            } else if (runs[i].second <= runs[i + 1].second) {
+                mergeRunAt(i);
+            } else {
+                break;
+            }
+        }
+    }
+
+    // 3. Merge whatever is left on the stack.
+    while (runs.size() > 1) {
+        size_t i = runs.size() - 2;
+        if (i > 0 && runs[i - 1].second < runs[i + 1].second) --i;
+        mergeRunAt(i);
+    }
+    Instr::leave();
+}
+
+/**
+ * @brief Stable, adaptive sort of [first, last) by comp (Timsort).
+ * O(n) on sorted/reversed input, O(n log n) worst case, O(n) extra memory.
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void timSortRange(RandomIt first, RandomIt last, Compare comp) {
+    if constexpr (Instr::enabled) {
+        timSortRuns<Instr>(first, last, CountingCompare<Instr, Compare>{comp});
+    } else {
+        timSortRuns<Instr>(first, last, comp);
+    }
+}
+
+/**
+ * @brief Stable sort of [first, last) by comp (Timsort).
+ */
+template <typename Instr = NoSortInstrumentation, typename RandomIt, typename Compare>
+void stableSortRange(RandomIt first, RandomIt last, Compare comp) {
+    timSortRange<Instr>(first, last, comp);
+}
+
+/**
+ * @brief Stable sort of [first, last) ascending by key(element) (Timsort).
+ */
+template <typename RandomIt, typename KeyFn>
+void stableSortBy(RandomIt first, RandomIt last, KeyFn key) {
+    typedef typename std::iterator_traits<RandomIt>::value_type Value;
+    timSortRange(first, last, [&](const Value& a, const Value& b) {
+        return std::invoke(key, a) < std::invoke(key, b);
+    });
+}
+
+#endif // GENERIC_SORTEX_H
@@ -0,0 +1,45 @@
+#ifndef KD_TREE_DATA_STRUCTUREEX_H
+#define KD_TREE_DATA_STRUCTUREEX_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "helloEx.h" // Vector2D
+
+// Declares the main function for the "k-d Tree" example module.
+void kd_tree_data_structureEx(void);
+
+// --- k-d Tree API (implemented in kd_tree_data_structureEx.cpp) ---
+
+// Static 2-d tree over a set of points, stored implicitly in one array: the
+// node of a range [lo, hi) is its median entry at (lo + hi) / 2, the left and
+// right subtrees are [lo, mid) and [mid + 1, hi), and the split axis
+// alternates x, y, x, ... with the depth. No child pointers are needed.
+// Results are indices into the vector the tree was built from.
+class KdTree {
+public:
+    // Builds by median split; the top levels are built by 'numThreads'
+    // threads in parallel (0 = all hardware threads).
+    explicit KdTree(const std::vector<Vector2D>& points, unsigned numThreads = 0);
+
+    size_t nearest(Vector2D query) const; // closest point, or size() if the tree is empty
+    std::vector<size_t> kNearest(Vector2D query, size_t k) const; // up to k points, closest first
+    std::vector<size_t> rangeQuery(Vector2D low, Vector2D high) const; // points in the box, inclusive
+    size_t size() const { return entries.size(); }
+
+private:
+    struct Entry {
+        Vector2D point;
+        uint32_t index; // position in the input vector
+    };
+
+    void build(size_t lo, size_t hi, unsigned depth, unsigned parallelDepth);
+    void nearestIn(size_t lo, size_t hi, unsigned depth, Vector2D query, float& bestDistance, size_t& best) const;
+    void kNearestIn(size_t lo, size_t hi, unsigned depth, Vector2D query, size_t k,
+                    std::vector<std::pair<float, uint32_t>>& heap) const;
+    void rangeIn(size_t lo, size_t hi, unsigned depth, Vector2D low, Vector2D high, std::vector<size_t>& out) const;
+
+    std::vector<Entry> entries;
+};
+
+#endif // KD_TREE_DATA_STRUCTUREEX_H
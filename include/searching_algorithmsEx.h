@@ -1,7 +1,108 @@
 #ifndef SEARCHING_ALGORITHMSEX_H
 #define SEARCHING_ALGORITHMSEX_H
 
+#include <vector>
+#include <cstddef>
+
 // Declares the main function for the "Searching Algorithms" example module.
 void searching_algorithmsEx(void);
 
-#endif // SEARCHING_ALGORITHMSEX_H
\ No newline at end of file
+// --- Searching API (implemented in searching_algorithmsEx.cpp) ---
+
+// Both return the index of 'target', or -1 if it is not present.
+int linearSearch(const std::vector<int>& arr, int target);
+int binarySearch(const std::vector<int>& arr, int target); // arr must be sorted
+
+// Estimates the position from the value (fast on evenly spread keys) and falls
+// back to bisection when the estimate is poor. Returns the first index, or -1.
+int interpolationSearch(const std::vector<int>& arr, int target); // arr must be sorted
+
+// Linear search for unsorted data with the SIMD kernels in simd_searchEx.cpp.
+int linearSearchSimd(const std::vector<int>& arr, int target);
+size_t countOccurrences(const std::vector<int>& arr, int target);
+std::vector<size_t> findAllOccurrences(const std::vector<int>& arr, int target);
+
+// Splits the scan across 'numThreads' threads (0 = all hardware threads) and
+// still returns the first index. Threads stop once an earlier match is known.
+int parallelLinearSearch(const std::vector<int>& arr, int target, unsigned numThreads = 0);
+
+// Looks up targets[0..count) in a sorted vector; results[i] = first index of
+// targets[i], or -1. Groups of searches advance in lock-step so their cache
+// misses overlap instead of being waited for one at a time.
+void binarySearchBatch(const std::vector<int>& sorted, const int* targets, size_t count, int* results);
+
+// Search index over a sorted vector, stored in Eytzinger (BFS) order: node k has
+// children 2k and 2k+1, so the first levels of the tree share a few cache lines
+// and the 16 nodes four levels below k are one cache line that can be prefetched.
+// Results are indices into the sorted vector the index was built from.
+class EytzingerIndex {
+public:
+    explicit EytzingerIndex(const std::vector<int>& sorted);
+
+    size_t lowerBound(int target) const; // first index with value >= target, or size()
+    size_t upperBound(int target) const; // first index with value > target, or size()
+    int find(int target) const;          // first index of target, or -1
+    size_t size() const { return count; }
+
+private:
+    size_t descend(int target, bool upper) const; // Eytzinger node of the bound, 0 = none
+    size_t sortedPosition(size_t k) const;        // node k -> index in the sorted vector
+    const int* keys() const { return storage.data() + keysOffset; }
+
+    std::vector<int> storage; // keys()[1..count] in BFS order, cache-line aligned
+    size_t keysOffset = 0;
+    size_t count = 0;
+    unsigned levels = 0; // height of the tree
+};
+
+// Static B+ tree over a sorted vector with 16-key nodes (one cache line each),
+// searched with SIMD compares: a lookup reads about log17(n) cache lines.
+// Pointer-free: the layers are stored one after another, root first.
+// Results are indices into the sorted vector the tree was built from.
+class STreeIndex {
+public:
+    explicit STreeIndex(const std::vector<int>& sorted);
+
+    size_t lowerBound(int target) const; // first index with value >= target, or size()
+    size_t upperBound(int target) const; // first index with value > target, or size()
+    int find(int target) const;          // first index of target, or -1
+    size_t countRange(int low, int high) const; // number of values in [low, high]
+    size_t size() const { return count; }
+    size_t memoryBytes() const; // total memory of the tree, including the copied keys
+
+private:
+    size_t descend(int target) const; // number of keys <= target
+    const int* keys() const { return storage.data() + keysOffset; }
+
+    std::vector<int> storage;          // all layers, cache-line aligned at keys()
+    std::vector<size_t> layerOffsets;  // start of each layer in keys(), root first
+    size_t keysOffset = 0;
+    size_t count = 0;
+};
+
+// Learned index: a piecewise-linear model of "key -> position" fitted to a
+// sorted vector, with every key predicted within maxError positions. A lookup
+// finds its segment, predicts a position and searches only that small window.
+// Keeps a pointer to the vector, which must outlive the index and not change.
+class LearnedIndex {
+public:
+    explicit LearnedIndex(const std::vector<int>& sorted, size_t maxError = 32);
+
+    size_t lowerBound(int target) const; // first index with value >= target, or size()
+    int find(int target) const;          // first index of target, or -1
+    size_t size() const { return data->size(); }
+    size_t segmentCount() const { return segments.size(); }
+
+private:
+    struct Segment {
+        int firstKey;
+        size_t firstPosition;
+        double slope; // positions per key unit
+    };
+
+    const std::vector<int>* data;
+    size_t maxError;
+    std::vector<Segment> segments; // ordered by firstKey
+};
+
+#endif // SEARCHING_ALGORITHMSEX_H
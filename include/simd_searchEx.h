@@ -0,0 +1,25 @@
+#ifndef SIMD_SEARCHEX_H
+#define SIMD_SEARCHEX_H
+
+#include <vector>
+#include <cstddef>
+
+// SIMD kernels for scanning unsorted int arrays, used by the linear searches
+// in searching_algorithmsEx.cpp. The implementation is chosen once at runtime:
+//   AVX2   : 16 ints per iteration (two 256-bit compares + one movemask test)
+//   SSE4.1 : 8 ints per iteration (two 128-bit compares)
+//   scalar : one int per iteration (non-x86 CPUs or compilers without target attributes)
+
+// Index of the first data[i] == target, or n if there is none.
+size_t simdFindFirst(const int* data, size_t n, int target);
+
+// Number of data[i] == target.
+size_t simdCount(const int* data, size_t n, int target);
+
+// Appends offset + i for every data[i] == target, in ascending order.
+void simdFindAll(const int* data, size_t n, int target, size_t offset, std::vector<size_t>& out);
+
+// Name of the selected implementation: "AVX2", "SSE4.1" or "scalar".
+const char* simdSearchIsa(void);
+
+#endif // SIMD_SEARCHEX_H
@@ -0,0 +1,87 @@
+#ifndef SORT_INSTRUMENTATIONEX_H
+#define SORT_INSTRUMENTATIONEX_H
+
+// Operation counting for the sorting algorithms.
+//
+// Sorts that support it take an instrumentation policy as a template parameter:
+//   NoSortInstrumentation       - the default. Every hook is an empty inline
+//                                 function, so the generated code is the same
+//                                 as without instrumentation.
+//   CountingSortInstrumentation - counts comparisons, element moves (a swap is
+//                                 3 moves) and the maximum recursion depth into
+//                                 a thread-local SortStats.
+//
+// Usage:
+//   CountingSortInstrumentation::reset();
+//   sortRange<CountingSortInstrumentation>(v.begin(), v.end(), std::less<int>());
+//   SortStats stats = CountingSortInstrumentation::stats();
+
+#include <cstdint>
+
+struct SortStats {
+    uint64_t comparisons = 0;
+    uint64_t moves = 0;
+    int maxDepth = 0; // deepest recursion (Timsort: most runs waiting to be merged)
+};
+
+struct NoSortInstrumentation {
+    static constexpr bool enabled = false;
+    static void compare() {}
+    static void move(uint64_t = 1) {}
+    static void swap() {}
+    static void enter() {}
+    static void leave() {}
+};
+
+struct CountingSortInstrumentation {
+    static constexpr bool enabled = true;
+    static void compare() { current().comparisons++; }
+    static void move(uint64_t count = 1) { current().moves += count; }
+    static void swap() { current().moves += 3; }
+    static void enter() {
+        int d = ++depth();
+        if (d > current().maxDepth) current().maxDepth = d;
+    }
+    static void leave() { --depth(); }
+
+    static void reset() {
+        current() = SortStats();
+        depth() = 0;
+    }
+    static SortStats stats() { return current(); }
+
+private:
+    static SortStats& current() {
+        static thread_local SortStats s;
+        return s;
+    }
+    static int& depth() {
+        static thread_local int d = 0;
+        return d;
+    }
+};
+
+/**
+ * @brief Marks one level of recursion for the lifetime of the object.
+ */
+template <typename Instr>
+struct SortDepthScope {
+    SortDepthScope() { Instr::enter(); }
+    ~SortDepthScope() { Instr::leave(); }
+};
+
+/**
+ * @brief Comparator wrapper that reports every call to the policy.
+ */
+template <typename Instr, typename Compare>
+struct CountingCompare {
+    Compare comp;
+
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+        Instr::compare();
+        return comp(a, b);
+    }
+};
+
+#endif // SORT_INSTRUMENTATIONEX_H
@@ -1,7 +1,124 @@
 #ifndef SORTING_ALGORITHMSEX_H
 #define SORTING_ALGORITHMSEX_H
 
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include "sort_instrumentationEx.h" // SortStats
+
 // Declares the main function for the "Sorting Algorithms" example module.
 void sorting_algorithmsEx(void);
 
-#endif // SORTING_ALGORITHMSEX_H
\ No newline at end of file
+// --- Sorting API (implemented in sorting_algorithmsEx.cpp) ---
+
+void bubbleSort(std::vector<int>& arr);
+void selectionSort(std::vector<int>& arr);
+void quickSort(std::vector<int>& arr, int low, int high);
+void quickSortHoare(std::vector<int>& arr, int low, int high);
+
+// Introsort: quicksort with median-of-three/ninther pivots that falls back to
+// heapsort when recursion gets too deep. Guaranteed O(n log n), O(log n) stack.
+void introSort(std::vector<int>& arr);
+
+// Pattern-defeating quicksort with a branchless block partition. Same signature
+// as quickSort/quickSortHoare (sorts arr[low..high] inclusive) for A/B testing.
+void pdqSort(std::vector<int>& arr, int low, int high);
+
+// LSD radix sort with 8-bit digits for 32-bit (signed) ints. O(n), no comparisons.
+void radixSort(std::vector<int>& arr);
+
+// Parallel sample sort on 'numThreads' threads (0 = all hardware threads).
+// Small inputs use the sequential pdqsort path. Output is identical to std::sort.
+void parallelSampleSort(std::vector<int>& arr, unsigned numThreads = 0);
+
+// Dual-pivot quicksort with three-way partitioning: runs of keys equal to a pivot
+// are excluded from recursion, so low-cardinality input stays fast.
+void dualPivotQuickSort(std::vector<int>& arr, int low, int high);
+
+// Timsort: stable natural merge sort with galloping merges. Near-linear time on
+// almost-sorted input (append-mostly logs, lists re-sorted after small edits).
+void timSort(std::vector<int>& arr);
+
+// --- Operation counting (see sort_instrumentationEx.h) ---
+
+// The same algorithms instantiated with CountingSortInstrumentation: they sort
+// 'arr' and return comparisons, element moves and the maximum recursion depth.
+// introSortCounted finishes small ranges with insertion sort instead of the
+// SIMD network, which has no individual comparisons to count.
+SortStats quickSortCounted(std::vector<int>& arr);
+SortStats quickSortHoareCounted(std::vector<int>& arr);
+SortStats introSortCounted(std::vector<int>& arr);
+SortStats timSortCounted(std::vector<int>& arr);
+
+// --- Selection: k-th element and top-k without a full sort ---
+
+// Introselect (like std::nth_element): afterwards arr[k] holds the value a full
+// sort would put there, with smaller-or-equal values before it and
+// greater-or-equal values after it. O(n), falls back to median-of-medians pivots.
+void introSelect(std::vector<int>& arr, size_t k);
+
+// Keeps the k largest (or smallest) values of a stream in a bounded heap:
+// O(k) memory and O(n log k) time, so the input never has to be stored.
+class StreamingTopK {
+public:
+    explicit StreamingTopK(size_t k, bool largest = true);
+    void push(int value);
+    std::vector<int> sorted() const; // best first: descending for largest, else ascending
+
+private:
+    std::vector<int> heap;
+    size_t k;
+    bool largest;
+};
+
+// Top-k over any input range, e.g. a container or std::istream_iterator<int>.
+template <typename InputIt>
+std::vector<int> streamTopK(InputIt first, InputIt last, size_t k, bool largest = true) {
+    StreamingTopK top(k, largest);
+    for (; first != last; ++first) {
+        top.push(*first);
+    }
+    return top.sorted();
+}
+
+// --- String sorting (multikey quicksort with cached 8-byte keys) ---
+
+struct Task; // helloEx.h
+
+// Returns the permutation that sorts 'keys' byte-wise; equal keys keep their order.
+std::vector<size_t> stringArgsort(const std::vector<std::string_view>& keys);
+void stringSort(std::vector<std::string>& strs);
+
+// Stable: tasks with the same title (or due date) keep their relative order.
+void sortTasksByTitle(std::vector<Task>& tasks);
+void sortTasksByDueDate(std::vector<Task>& tasks);
+
+// --- External merge sort for binary int32 files larger than RAM ---
+
+struct ExternalSortConfig {
+    size_t memoryBudgetBytes = 256 * 1024 * 1024; // RAM used for chunks and merge buffers, at least 192 KiB
+    std::string tempDir = ".";                      // where sorted run files are spilled
+};
+
+struct ExternalSortStats {
+    uint64_t elements = 0;
+    size_t runs = 0;            // sorted runs written in phase 1
+    size_t mergePasses = 0;     // 1 unless there were more runs than merge buffers
+    double runFormationSeconds = 0.0;
+    double mergeSeconds = 0.0;
+    uint64_t runFormationBytes = 0; // bytes read + written in phase 1
+    uint64_t mergeBytes = 0;        // bytes read + written in phase 2
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+};
+
+// Sorts 'inputPath' into 'outputPath': sorted runs are spilled to temp files and
+// k-way merged with a loser tree. Returns false if a file could not be read or written,
+// or if the memory budget is too small for a two-way merge.
+bool externalSort(const std::string& inputPath, const std::string& outputPath,
+                  const ExternalSortConfig& config, ExternalSortStats& stats);
+void printExternalSortStats(const ExternalSortStats& stats);
+
+#endif // SORTING_ALGORITHMSEX_H
@@ -0,0 +1,21 @@
+#ifndef SORTING_NETWORKSEX_H
+#define SORTING_NETWORKSEX_H
+
+#include <cstddef>
+
+// SIMD sorting networks for tiny ranges, used as the base case of
+// introSort/pdqSort. The implementation is chosen once at runtime:
+//   AVX2   : 8/16/32/64-int kernels in 256-bit registers + bitonic merges
+//   SSE4.1 : up to 16 ints in 128-bit registers
+//   scalar : insertion sort (non-x86 CPUs or compilers without target attributes)
+
+// Largest range sortNetwork() accepts on this CPU (64 with AVX2, otherwise 16).
+size_t sortNetworkLimit(void);
+
+// Sorts [first, last). Requires last - first <= sortNetworkLimit().
+void sortNetwork(int* first, int* last);
+
+// Name of the selected implementation: "AVX2", "SSE4.1" or "scalar".
+const char* sortNetworkIsa(void);
+
+#endif // SORTING_NETWORKSEX_H
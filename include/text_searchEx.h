@@ -0,0 +1,126 @@
+#ifndef TEXT_SEARCHEX_H
+#define TEXT_SEARCHEX_H
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+// Declares the main function for the "Text Search" example module.
+void text_searchEx(void);
+
+// --- Text Search API (implemented in text_searchEx.cpp) ---
+
+// Single-pattern substring search. The implementation is chosen once at runtime:
+//   AVX2/SSE4.1 : compares the pattern's first and last byte against 32/16
+//                 window positions at once; only windows where both match are
+//                 verified with memcmp.
+//   scalar      : Boyer-Moore-Horspool (also used for the last few bytes).
+class SubstringSearcher {
+public:
+    explicit SubstringSearcher(std::string pattern);
+
+    // Appends offset + position of every match in text, overlapping ones
+    // included, in ascending order. An empty pattern matches nothing.
+    void findAll(std::string_view text, size_t offset, std::vector<size_t>& out) const;
+    size_t patternLength() const { return pattern.size(); }
+
+private:
+    std::string pattern;
+    size_t shift[256]; // Horspool: how far to move the window for its last byte
+};
+
+// Multi-pattern search (Aho-Corasick): one pass over the text finds every
+// occurrence of every pattern, however many patterns there are.
+class AhoCorasick {
+public:
+    struct Match {
+        size_t position; // start of the occurrence in the text
+        size_t pattern;  // index into the pattern list
+    };
+
+    explicit AhoCorasick(const std::vector<std::string>& patterns);
+
+    // Scans one piece of a longer text starting in automaton state 'state'
+    // (0 at the beginning of the text) and returns the state to continue with.
+    // Matches that span two pieces are found, because the state carries over.
+    uint32_t feed(uint32_t state, std::string_view text, size_t offset, std::vector<Match>& out) const;
+    std::vector<Match> findAll(std::string_view text) const;
+
+private:
+    std::vector<uint32_t> next;           // next[state * 256 + byte]: full DFA transition table
+    std::vector<uint32_t> dictionaryLink; // nearest proper suffix state that ends a pattern, 0 = none
+    std::vector<std::vector<uint32_t>> patternsAt; // patterns ending exactly at each state
+    std::vector<size_t> lengths;          // pattern lengths, to turn match ends into starts
+};
+
+// --- Fuzzy (typo-tolerant) search ---
+
+// Smallest edit distance (insertions, deletions, substitutions) between
+// 'pattern' and any substring of 'text', ignoring ASCII case. Patterns of up to
+// 64 characters use Myers' bit-vector algorithm: one 64-bit word per text byte.
+int fuzzyDistance(std::string_view pattern, std::string_view text);
+
+// Fuzzy search over many short documents (e.g. task titles). A q-gram index
+// skips documents that cannot contain a close enough match: a substring within
+// k edits of the pattern still shares at least (m - q + 1) - k * q of the
+// pattern's q-grams. Only the remaining candidates are verified with Myers.
+class FuzzyIndex {
+public:
+    struct Hit {
+        size_t document; // index into the documents the index was built from
+        int distance;
+    };
+
+    explicit FuzzyIndex(const std::vector<std::string>& documents);
+
+    // Documents with a substring within maxErrors edits of pattern, closest first.
+    // 'verified' (optional) receives how many documents needed the full check.
+    std::vector<Hit> search(std::string_view pattern, int maxErrors, size_t* verified = nullptr) const;
+    size_t size() const { return documents.size(); }
+
+private:
+    std::vector<std::string> documents; // lower-cased copies
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings; // q-gram -> documents containing it, ascending
+};
+
+// --- Task search (shared by both task managers) ---
+
+struct Task; // helloEx.h
+
+// Fuzzy index over a task list. Titles and descriptions are separate
+// documents, so a match never spans the two fields. Build it once and rebuild
+// it only when tasks are added or removed.
+class TaskSearchIndex {
+public:
+    struct Hit {
+        size_t task; // index into the task list the index was built from
+        int distance;
+    };
+
+    TaskSearchIndex() : index({}) {}
+    TaskSearchIndex(const std::vector<std::string>& titles, const std::vector<std::string>& descriptions);
+
+    // Tasks whose title or description is within maxErrors edits, closest first.
+    std::vector<Hit> search(std::string_view pattern, int maxErrors) const;
+
+private:
+    FuzzyIndex index; // document 2 * i is the title of task i, 2 * i + 1 its description
+};
+
+// Prompts for the search text and allowed typos (0-3) and prints the matching
+// tasks. 'tasks' must be the list 'index' was built from.
+void searchTasksInteractive(const TaskSearchIndex& index, const std::vector<const Task*>& tasks);
+
+// Stream a file through the searchers in large chunks, without loading it
+// whole. Both return false (and print an error) if the file cannot be read.
+bool searchFile(const std::string& path, const std::string& pattern, std::vector<size_t>& positions);
+bool searchFileMulti(const std::string& path, const std::vector<std::string>& patterns,
+                     std::vector<AhoCorasick::Match>& matches);
+
+// Name of the selected substring search implementation: "AVX2", "SSE4.1" or "scalar".
+const char* textSearchIsa(void);
+
+#endif // TEXT_SEARCHEX_H
@@ -2,10 +2,43 @@
 #include <string>
 #include <vector>
 #include <list>      // Using std::list for chaining
+#include <unordered_map> // Benchmark baseline
+#include <algorithm>     // For std::fill
+#include <limits>        // For std::numeric_limits
+#include <chrono>        // For the benchmark
+#include <iomanip>       // For std::setw (benchmark tables)
+#include <cstdint>
+#include <cstring>       // For std::memcpy
+#include <random>        // For std::random_device (hash seeds)
+#include <fstream>       // For the key file of the hash quality report
+#include <atomic>        // Concurrent table: version counters
+#include <shared_mutex>  // Concurrent table: reader/writer stripe locks
+#include <mutex>
+#include <thread>
+#include <memory>
 #include "helloEx.h" // for printLine
+#include "cpu_featuresEx.h" // SIMD_X86
 #include "hash_table_data_structureEx.h"
 
-const int TABLE_SIZE = 10;
+const int TABLE_SIZE = 10; // initial number of buckets
+
+// --- Growth with incremental rehashing ---
+//
+// When the load factor (entries per bucket) passes MAX_LOAD_FACTOR the table
+// doubles its bucket count. Moving every entry at once would make that one
+// insert take O(n), so the old bucket array stays live instead, and every
+// operation moves the next REHASH_BUCKETS_PER_OP buckets into the new array.
+// Until the migration is finished a key may be in either array, so lookups
+// check the new bucket and, if it has not been moved yet, the old one.
+// Moving a chain splices its list nodes: no allocation, no copies.
+// The bucket arrays themselves are split into segments of BUCKET_SEGMENT_SIZE
+// buckets. A new array starts as a directory of empty segment pointers and a
+// segment is only built when one of its buckets is first used; an old segment
+// is freed as soon as its buckets are migrated. So neither building the new
+// array nor freeing the old one happens in one O(n) step.
+const double MAX_LOAD_FACTOR = 1.0;
+const size_t REHASH_BUCKETS_PER_OP = 4;
+const size_t BUCKET_SEGMENT_SIZE = 1024;
 
 // A node in the hash table chain
 struct HashNode {
@@ -13,47 +46,281 @@ struct HashNode {
     int value;
 };
 
+// Statistics reported by HashTable::stats().
+struct HashTableStats {
+    size_t size;            // number of entries
+    size_t bucketCount;     // buckets of the current (new) array
+    double loadFactor;      // size / bucketCount
+    size_t oldBucketCount;  // buckets still being drained, 0 = no migration
+    size_t migratedBuckets; // how many of them have been moved already
+};
+
+// --- Hasher policies ---
+//
+// A hasher is constructed from a 64-bit seed and maps a key to a 64-bit hash.
+// Every table draws a fresh random seed. As long as the seed enters every
+// step of the hash, an attacker who does not know it cannot precompute a set
+// of keys that all land in one bucket.
+
+/**
+ * @brief A random seed for a new table.
+ */
+static uint64_t randomHashSeed() {
+    static std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+}
+
+/**
+ * @brief The original hash: the sum of the key's bytes. The seed is ignored.
+ * Anagrams ("apple", "ppale") always collide and short keys only reach a few
+ * hundred distinct values; kept to compare against.
+ */
+struct AdditiveHasher {
+    explicit AdditiveHasher(uint64_t) {}
+
+    uint64_t operator()(const std::string& key) const {
+        uint64_t hash = 0;
+        for (char ch : key) {
+            hash += static_cast<unsigned char>(ch);
+        }
+        return hash;
+    }
+};
+
+/**
+ * @brief Seeded string hash in the style of wyhash: the key is consumed 8
+ * bytes at a time (16 per loop step) and mixed with 64x64->128-bit multiplies.
+ * Every constant that key bytes are combined with is a secret derived from the
+ * seed (like wyhash's make_secret), so no key can zero a multiplicand, and
+ * with it the seed, without knowing the seed.
+ */
+struct FastStringHasher {
+    explicit FastStringHasher(uint64_t seed) {
+        uint64_t x = seed;
+        secret0 = splitMix64(x);
+        secret1 = splitMix64(x);
+        start = splitMix64(x);
+    }
+
+    uint64_t operator()(const std::string& key) const {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(key.data());
+        size_t length = key.size();
+        uint64_t state = start, a, b;
+        if (length <= 16) {
+            if (length >= 4) {
+                // Two overlapping 4-byte reads from each end cover 4..16 bytes.
+                size_t middle = (length >> 3) << 2;
+                a = (read4(p) << 32) | read4(p + middle);
+                b = (read4(p + length - 4) << 32) | read4(p + length - 4 - middle);
+            } else if (length > 0) {
+                a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t remaining = length;
+            while (remaining > 16) {
+                state = mix(read8(p) ^ secret1, read8(p + 8) ^ state);
+                p += 16;
+                remaining -= 16;
+            }
+            // The last 16 bytes, overlapping the loop if the length is not a multiple of 16.
+            a = read8(p + remaining - 16);
+            b = read8(p + remaining - 8);
+        }
+        uint64_t high, low = multiply(a ^ secret1, b ^ state, high);
+        return mix(low ^ secret0 ^ length, high ^ secret1);
+    }
+
+private:
+    uint64_t secret0, secret1, start;
+
+    static uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    static uint64_t read8(const unsigned char* p) {
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        return v;
+    }
+    static uint64_t read4(const unsigned char* p) {
+        uint32_t v;
+        std::memcpy(&v, p, 4);
+        return v;
+    }
+
+    /**
+     * @brief Full 128-bit product of a and b: returns the low half, stores the high half.
+     */
+    static uint64_t multiply(uint64_t a, uint64_t b, uint64_t& high) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        high = static_cast<uint64_t>(product >> 64);
+        return static_cast<uint64_t>(product);
+#else
+        uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32, bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+        uint64_t low = aLow * bLow, middle1 = aHigh * bLow, middle2 = aLow * bHigh;
+        uint64_t carry = ((low >> 32) + (middle1 & 0xFFFFFFFF) + (middle2 & 0xFFFFFFFF)) >> 32;
+        high = aHigh * bHigh + (middle1 >> 32) + (middle2 >> 32) + carry;
+        return low + (middle1 << 32) + (middle2 << 32);
+#endif
+    }
+
+    static uint64_t mix(uint64_t a, uint64_t b) {
+        uint64_t high, low = multiply(a, b, high);
+        return low ^ high;
+    }
+};
+
+/**
+ * @brief Array of bucket chains stored in segments that are allocated on first
+ * use and can be freed one at a time.
+ */
+class BucketArray {
+public:
+    BucketArray() = default;
+    explicit BucketArray(size_t count)
+        : count(count), segments((count + BUCKET_SEGMENT_SIZE - 1) / BUCKET_SEGMENT_SIZE) {}
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief The chain of bucket i, building its segment if needed.
+     */
+    std::list<HashNode>& operator[](size_t i) {
+        std::unique_ptr<std::list<HashNode>[]>& segment = segments[i / BUCKET_SEGMENT_SIZE];
+        if (!segment) {
+            size_t first = i - i % BUCKET_SEGMENT_SIZE;
+            segment.reset(new std::list<HashNode>[std::min(BUCKET_SEGMENT_SIZE, count - first)]);
+        }
+        return segment[i % BUCKET_SEGMENT_SIZE];
+    }
+
+    /**
+     * @brief The chain of bucket i, or nullptr if its segment was never built
+     * (every bucket in it is empty) or has been released.
+     */
+    std::list<HashNode>* find(size_t i) {
+        std::unique_ptr<std::list<HashNode>[]>& segment = segments[i / BUCKET_SEGMENT_SIZE];
+        return segment ? &segment[i % BUCKET_SEGMENT_SIZE] : nullptr;
+    }
+    const std::list<HashNode>* find(size_t i) const {
+        const std::unique_ptr<std::list<HashNode>[]>& segment = segments[i / BUCKET_SEGMENT_SIZE];
+        return segment ? &segment[i % BUCKET_SEGMENT_SIZE] : nullptr;
+    }
+
+    void releaseSegment(size_t segment) { segments[segment].reset(); }
+
+private:
+    size_t count = 0;
+    std::vector<std::unique_ptr<std::list<HashNode>[]>> segments;
+};
+
+template <typename Hasher = FastStringHasher>
 class HashTable {
 private:
     // table is a vector of lists. Each list is a chain for a bucket.
-    std::vector<std::list<HashNode>> table;
+    BucketArray table;
+    BucketArray oldTable; // drained during a resize, empty otherwise
+    size_t migrated = 0; // oldTable[0..migrated) have been moved into table
+    size_t count = 0;
+    bool verbose; // print every operation (off for benchmarks)
+    Hasher hasher;
 
     /**
-     * @brief A simple hash function that sums the ASCII values of characters.
+     * @brief Hashes a key with the table's seeded hasher.
      * @param key The string key to hash.
-     * @return An index for the hash table.
+     * @return The hash value; the bucket is hash % bucket count.
      */
-    int hashFunction(const std::string& key) {
-        int hash = 0;
-        for (char ch : key) {
-            hash += ch;
+    size_t hashFunction(const std::string& key) const {
+        return static_cast<size_t>(hasher(key));
+    }
+
+    /**
+     * @brief The old-array chain that may still hold 'key', or nullptr.
+     */
+    std::list<HashNode>* pendingChain(size_t hash) {
+        if (oldTable.empty()) return nullptr;
+        size_t index = hash % oldTable.size();
+        return index >= migrated ? oldTable.find(index) : nullptr;
+    }
+
+    /**
+     * @brief Moves up to REHASH_BUCKETS_PER_OP old buckets into the new array.
+     */
+    void migrateStep() {
+        for (size_t step = 0; step < REHASH_BUCKETS_PER_OP && migrated < oldTable.size(); ++step) {
+            if (std::list<HashNode>* chain = oldTable.find(migrated)) {
+                while (!chain->empty()) {
+                    std::list<HashNode>& target = table[hashFunction(chain->front().key) % table.size()];
+                    target.splice(target.end(), *chain, chain->begin());
+                }
+            }
+            ++migrated;
+            // Free each old segment as soon as it is drained.
+            if (migrated % BUCKET_SEGMENT_SIZE == 0 || migrated == oldTable.size()) {
+                oldTable.releaseSegment((migrated - 1) / BUCKET_SEGMENT_SIZE);
+            }
+        }
+        if (!oldTable.empty() && migrated == oldTable.size()) {
+            oldTable = BucketArray(); // only the (already empty) segment directory is left
+            migrated = 0;
         }
-        return hash % TABLE_SIZE;
+    }
+
+    /**
+     * @brief Starts a migration into twice as many buckets if the table is too full.
+     */
+    void growIfNeeded() {
+        if (!oldTable.empty() || static_cast<double>(count) <= MAX_LOAD_FACTOR * table.size()) return;
+        oldTable = std::move(table);
+        table = BucketArray(oldTable.size() * 2); // segments are built as they are used
+        migrated = 0;
+        if (verbose) std::cout << "Growing to " << table.size() << " buckets (incremental rehash started).\n";
+    }
+
+    static HashNode* findIn(std::list<HashNode>* chain, const std::string& key) {
+        if (!chain) return nullptr;
+        for (auto& node : *chain) {
+            if (node.key == key) return &node;
+        }
+        return nullptr;
     }
 
 public:
     /**
-     * @brief Constructor to initialize the table size.
+     * @brief Constructor to initialize the table size and the hash seed.
      */
-    HashTable() : table(TABLE_SIZE) {}
+    explicit HashTable(bool verbose = true, uint64_t seed = randomHashSeed())
+        : table(TABLE_SIZE), verbose(verbose), hasher(seed) {}
 
     /**
      * @brief Inserts a key-value pair into the hash table.
      * If the key already exists, its value is updated.
      */
     void insert(const std::string& key, int value) {
-        int index = hashFunction(key);
+        migrateStep();
+        size_t hash = hashFunction(key);
+        size_t index = hash % table.size();
         // Find if the key already exists in the chain
-        for (auto& node : table[index]) {
-            if (node.key == key) {
-                node.value = value; // Update existing key
-                std::cout << "Updated key '" << key << "' with value " << value << ".\n";
-                return;
-            }
+        HashNode* node = findIn(table.find(index), key);
+        if (!node) node = findIn(pendingChain(hash), key);
+        if (node) {
+            node->value = value; // Update existing key
+            if (verbose) std::cout << "Updated key '" << key << "' with value " << value << ".\n";
+            return;
         }
         // If key not found, add a new node to the chain
         table[index].push_back({key, value});
-        std::cout << "Inserted key '" << key << "' with value " << value << " at index " << index << ".\n";
+        ++count;
+        if (verbose) std::cout << "Inserted key '" << key << "' with value " << value << " at index " << index << ".\n";
+        growIfNeeded();
     }
 
     /**
@@ -61,14 +328,15 @@ public:
      * @return The value if the key is found, otherwise -1.
      */
     int search(const std::string& key) {
-        int index = hashFunction(key);
-        for (const auto& node : table[index]) {
-            if (node.key == key) {
-                std::cout << "Found key '" << key << "', value is " << node.value << ".\n";
-                return node.value;
-            }
+        migrateStep();
+        size_t hash = hashFunction(key);
+        HashNode* node = findIn(table.find(hash % table.size()), key);
+        if (!node) node = findIn(pendingChain(hash), key);
+        if (node) {
+            if (verbose) std::cout << "Found key '" << key << "', value is " << node->value << ".\n";
+            return node->value;
         }
-        std::cout << "Key '" << key << "' not found.\n";
+        if (verbose) std::cout << "Key '" << key << "' not found.\n";
         return -1; // Not found
     }
 
@@ -76,14 +344,47 @@ public:
      * @brief Removes a key-value pair from the hash table.
      */
     void remove(const std::string& key) {
-        int index = hashFunction(key);
-        table[index].remove_if([&](const HashNode& node) {
-            if (node.key == key) {
-                std::cout << "Removed key '" << key << "'.\n";
-                return true;
+        migrateStep();
+        size_t hash = hashFunction(key);
+        auto matches = [&](const HashNode& node) { return node.key == key; };
+        size_t removed = 0;
+        for (std::list<HashNode>* chain : {table.find(hash % table.size()), pendingChain(hash)}) {
+            if (!chain) continue;
+            size_t before = chain->size();
+            chain->remove_if(matches);
+            removed += before - chain->size();
+        }
+        if (removed > 0) {
+            count -= removed;
+            if (verbose) std::cout << "Removed key '" << key << "'.\n";
+        }
+    }
+
+    /**
+     * @brief Reports size, load factor and the progress of a running migration.
+     */
+    HashTableStats stats() const {
+        return {count, table.size(), static_cast<double>(count) / table.size(), oldTable.size(),
+                oldTable.empty() ? 0 : migrated};
+    }
+
+    /**
+     * @brief histogram[k] = number of buckets whose chain holds k entries.
+     * Old buckets that are not migrated yet are counted too.
+     */
+    std::vector<size_t> chainLengthHistogram() const {
+        std::vector<size_t> histogram;
+        auto add = [&](const BucketArray& buckets, size_t first) {
+            for (size_t i = first; i < buckets.size(); ++i) {
+                const std::list<HashNode>* chain = buckets.find(i);
+                size_t length = chain ? chain->size() : 0;
+                if (length >= histogram.size()) histogram.resize(length + 1);
+                ++histogram[length];
             }
-            return false;
-        });
+        };
+        add(table, 0);
+        if (!oldTable.empty()) add(oldTable, migrated);
+        return histogram;
     }
 
     /**
@@ -91,36 +392,959 @@ public:
      */
     void display() {
         printLine("Hash Table Contents");
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            std::cout << "Bucket " << i << ": ";
-            for (const auto& node : table[i]) {
-                std::cout << "['" << node.key << "':" << node.value << "] -> ";
+        auto printBuckets = [](const BucketArray& buckets, size_t first) {
+            for (size_t i = first; i < buckets.size(); ++i) {
+                std::cout << "Bucket " << i << ": ";
+                if (const std::list<HashNode>* chain = buckets.find(i)) {
+                    for (const auto& node : *chain) {
+                        std::cout << "['" << node.key << "':" << node.value << "] -> ";
+                    }
+                }
+                std::cout << "nullptr\n";
             }
-            std::cout << "nullptr\n";
+        };
+        printBuckets(table, 0);
+        if (!oldTable.empty()) {
+            std::cout << "Not yet migrated (old array of " << oldTable.size() << " buckets):\n";
+            printBuckets(oldTable, migrated);
         }
     }
 };
 
-void hash_table_data_structureEx(void) {
-    printLine("Hash Table Data Structure Example");
+// --- Flat (Swiss-table style) hash table ---
+//
+// HashTable allocates a list node per key and follows pointers on every
+// lookup. FlatHashTable stores the entries in one array (open addressing) plus
+// one control byte per slot:
+//   CTRL_EMPTY   - never used since the last rehash; ends every probe
+//   CTRL_DELETED - removed entry (tombstone); probes continue past it
+//   0..127       - used; the low 7 bits of the key's hash ("h2")
+// Slots are probed in groups of 16. One SIMD compare checks all 16 control
+// bytes against h2, so the key itself is compared only for the rare slots
+// whose 7 hash bits also match, and a second compare finds empty slots.
+// SSE2 is part of every x86-64 CPU, so no runtime dispatch is needed here.
+
+const int8_t CTRL_EMPTY = -128;   // 0b10000000
+const int8_t CTRL_DELETED = -2;   // 0b11111110
+const size_t FLAT_GROUP_SIZE = 16;
+const size_t FLAT_MIN_CAPACITY = 16;
+
+/**
+ * @brief Bit i is set where group[i] == value (group holds 16 control bytes).
+ */
+static inline unsigned matchControlBytes(const int8_t* group, int8_t value) {
+#if SIMD_X86 && defined(__SSE2__)
+    __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+#else
+    unsigned mask = 0;
+    for (size_t i = 0; i < FLAT_GROUP_SIZE; ++i) {
+        if (group[i] == value) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+template <typename Hasher = FastStringHasher>
+class FlatHashTable {
+private:
+    // Control bytes, 16-byte aligned so each group is one aligned SSE load.
+    struct alignas(FLAT_GROUP_SIZE) ControlGroup {
+        int8_t bytes[FLAT_GROUP_SIZE];
+    };
+
+    std::vector<ControlGroup> control;
+    std::vector<HashNode> slots;
+    size_t used = 0;       // live entries
+    size_t tombstones = 0; // CTRL_DELETED slots
+    bool verbose;
+    Hasher hasher;
+
+    size_t capacity() const { return slots.size(); }
+    int8_t* ctrl() { return control.empty() ? nullptr : control[0].bytes; }
+    const int8_t* ctrl() const { return control.empty() ? nullptr : control[0].bytes; }
+
+    /**
+     * @brief Finds the slot holding 'key', or returns capacity() if it is absent.
+     * Probing visits groups g, g+1, g+3, g+6, ... (triangular steps), which
+     * reaches every group exactly once because the group count is a power of 2.
+     */
+    size_t findSlot(const std::string& key, size_t hash) const {
+        if (slots.empty()) return 0;
+        size_t groupMask = control.size() - 1;
+        int8_t h2 = static_cast<int8_t>(hash & 0x7F);
+        size_t group = (hash >> 7) & groupMask;
+        for (size_t step = 1; step <= control.size(); ++step) {
+            const int8_t* bytes = control[group].bytes;
+            for (unsigned mask = matchControlBytes(bytes, h2); mask != 0; mask &= mask - 1) {
+                size_t slot = group * FLAT_GROUP_SIZE + static_cast<size_t>(__builtin_ctz(mask));
+                if (slots[slot].key == key) return slot;
+            }
+            if (matchControlBytes(bytes, CTRL_EMPTY) != 0) break; // the key would have been placed here
+            group = (group + step) & groupMask;
+        }
+        return capacity();
+    }
+
+    /**
+     * @brief First empty or deleted slot on the probe sequence of 'hash'.
+     * There always is one: the table is never allowed to fill up.
+     */
+    size_t findFreeSlot(size_t hash) const {
+        size_t groupMask = control.size() - 1;
+        size_t group = (hash >> 7) & groupMask;
+        for (size_t step = 1;; ++step) {
+            // Empty and deleted bytes are exactly the negative ones.
+            const int8_t* bytes = control[group].bytes;
+            unsigned available = matchControlBytes(bytes, CTRL_EMPTY) | matchControlBytes(bytes, CTRL_DELETED);
+            if (available != 0) return group * FLAT_GROUP_SIZE + static_cast<size_t>(__builtin_ctz(available));
+            group = (group + step) & groupMask;
+        }
+    }
+
+    /**
+     * @brief Moves every live entry into a table of 'newCapacity' slots.
+     * Tombstones are dropped on the way.
+     */
+    void rehash(size_t newCapacity) {
+        std::vector<ControlGroup> oldControl(newCapacity / FLAT_GROUP_SIZE);
+        std::vector<HashNode> oldSlots(newCapacity);
+        oldControl.swap(control);
+        oldSlots.swap(slots);
+        for (ControlGroup& group : control) std::fill(group.bytes, group.bytes + FLAT_GROUP_SIZE, CTRL_EMPTY);
+        tombstones = 0;
+
+        const int8_t* oldBytes = oldControl.empty() ? nullptr : oldControl[0].bytes;
+        for (size_t i = 0; i < oldSlots.size(); ++i) {
+            if (oldBytes[i] < 0) continue; // empty or deleted
+            size_t hash = static_cast<size_t>(hasher(oldSlots[i].key));
+            size_t slot = findFreeSlot(hash);
+            ctrl()[slot] = static_cast<int8_t>(hash & 0x7F);
+            slots[slot] = std::move(oldSlots[i]);
+        }
+    }
+
+public:
+    explicit FlatHashTable(bool verbose = true, uint64_t seed = randomHashSeed()) : verbose(verbose), hasher(seed) {}
+
+    /**
+     * @brief Inserts a key-value pair into the hash table.
+     * If the key already exists, its value is updated.
+     */
+    void insert(const std::string& key, int value) {
+        size_t hash = static_cast<size_t>(hasher(key));
+        size_t slot = findSlot(key, hash);
+        if (slot < capacity()) {
+            slots[slot].value = value;
+            if (verbose) std::cout << "Updated key '" << key << "' with value " << value << ".\n";
+            return;
+        }
+        // Keep at least 1/8 of the slots empty so probes stay short.
+        if ((used + tombstones + 1) * 8 > capacity() * 7) {
+            // Mostly tombstones: rehashing at the same size is enough to clean them up.
+            size_t newCapacity = std::max(FLAT_MIN_CAPACITY, capacity());
+            if ((used + 1) * 16 > capacity() * 7) newCapacity = std::max(FLAT_MIN_CAPACITY, capacity() * 2);
+            rehash(newCapacity);
+        }
+        slot = findFreeSlot(hash);
+        if (ctrl()[slot] == CTRL_DELETED) --tombstones;
+        ctrl()[slot] = static_cast<int8_t>(hash & 0x7F);
+        slots[slot] = {key, value};
+        ++used;
+        if (verbose) std::cout << "Inserted key '" << key << "' with value " << value << " at slot " << slot << ".\n";
+    }
+
+    /**
+     * @brief Searches for a key and returns its value.
+     * @return The value if the key is found, otherwise -1.
+     */
+    int search(const std::string& key) const {
+        size_t slot = findSlot(key, static_cast<size_t>(hasher(key)));
+        if (slot < capacity()) {
+            if (verbose) std::cout << "Found key '" << key << "', value is " << slots[slot].value << ".\n";
+            return slots[slot].value;
+        }
+        if (verbose) std::cout << "Key '" << key << "' not found.\n";
+        return -1; // Not found
+    }
+
+    /**
+     * @brief Removes a key-value pair from the hash table.
+     */
+    void remove(const std::string& key) {
+        size_t slot = findSlot(key, static_cast<size_t>(hasher(key)));
+        if (slot >= capacity()) return;
+        // A group that still has an empty slot has never been full, so no probe
+        // ever continued past it: the slot can become empty again. Otherwise a
+        // tombstone keeps the probe chains through this group intact.
+        int8_t* group = ctrl() + (slot / FLAT_GROUP_SIZE) * FLAT_GROUP_SIZE;
+        if (matchControlBytes(group, CTRL_EMPTY) != 0) {
+            ctrl()[slot] = CTRL_EMPTY;
+        } else {
+            ctrl()[slot] = CTRL_DELETED;
+            ++tombstones;
+        }
+        slots[slot] = HashNode();
+        --used;
+        if (verbose) std::cout << "Removed key '" << key << "'.\n";
+    }
+
+    size_t size() const { return used; }
+
+    /**
+     * @brief Displays the used slots of the hash table.
+     */
+    void display() const {
+        printLine("Flat Hash Table Contents");
+        std::cout << used << " entries in " << capacity() << " slots (" << tombstones << " tombstones)\n";
+        for (size_t i = 0; i < capacity(); ++i) {
+            if (ctrl()[i] >= 0) {
+                std::cout << "Slot " << i << " (h2 " << static_cast<int>(ctrl()[i]) << "): ['" << slots[i].key
+                          << "':" << slots[i].value << "]\n";
+            }
+        }
+    }
+};
+
+// --- Concurrent (lock-striped) hash table ---
+//
+// The keys are spread over a fixed number of stripes by the top bits of their
+// hash. Each stripe is a small open-addressing table (linear probing) with its
+// own reader/writer lock, and sits on its own cache lines, so threads working
+// on different stripes never contend on a lock or a line.
+//
+// Reads of keys up to KEY_INLINE_BYTES long usually take no lock at all. Each
+// stripe has a version counter that writers make odd before changing the slots
+// and even again afterwards (a seqlock). A reader notes the version, probes
+// with plain atomic loads, and keeps the result only if the version is still
+// the same even number; otherwise it retries, and after a few failed attempts
+// it takes the shared lock. The reader writes no shared memory, so read-mostly
+// workloads scale with the thread count.
+//
+// An optimistic reader may still be probing a slot array while a writer grows
+// the stripe, so replaced arrays are kept until the table is destroyed. They
+// double each time, so together they are smaller than the current one.
+
+const size_t CACHE_LINE_BYTES = 64;
+const size_t KEY_INLINE_WORDS = 3;
+const size_t KEY_INLINE_BYTES = KEY_INLINE_WORDS * sizeof(uint64_t); // longer keys are always read under the lock
+const size_t STRIPE_MIN_CAPACITY = 16;
+const int OPTIMISTIC_READ_ATTEMPTS = 4;
+
+template <typename Hasher = FastStringHasher>
+class ConcurrentHashTable {
+private:
+    // Every field an optimistic reader looks at is atomic; 'key' is only
+    // touched under the stripe lock.
+    struct Slot {
+        std::atomic<uint64_t> tag{0}; // 0 = empty, otherwise hash | 1
+        std::atomic<int> value{0};
+        std::atomic<uint32_t> length{0};
+        std::atomic<uint64_t> inlineKey[KEY_INLINE_WORDS] = {}; // first bytes of the key, zero padded
+        std::string key;
+    };
+
+    struct SlotArray {
+        explicit SlotArray(size_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {}
+        size_t mask; // capacity - 1, capacity is a power of 2
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    struct alignas(CACHE_LINE_BYTES) Stripe {
+        std::shared_mutex lock;
+        std::atomic<uint64_t> version{0}; // odd while a writer is changing the slots
+        std::atomic<SlotArray*> current{nullptr};
+        std::vector<std::unique_ptr<SlotArray>> arrays; // current one last, older ones kept for readers
+        size_t used = 0;
+    };
+
+    // The lookup key in the form the slots store it.
+    struct Probe {
+        uint64_t tag;
+        uint32_t length;
+        uint64_t words[KEY_INLINE_WORDS];
+    };
+
+    std::unique_ptr<Stripe[]> stripes;
+    unsigned stripeBits;
+    bool optimisticReads;
+    Hasher hasher;
+
+    Probe makeProbe(const std::string& key) const {
+        Probe probe;
+        probe.tag = hasher(key) | 1;
+        probe.length = static_cast<uint32_t>(key.size());
+        std::memset(probe.words, 0, sizeof(probe.words));
+        std::memcpy(probe.words, key.data(), std::min(key.size(), KEY_INLINE_BYTES));
+        return probe;
+    }
+
+    Stripe& stripeFor(uint64_t tag) const {
+        return stripes[stripeBits == 0 ? 0 : static_cast<size_t>(tag >> (64 - stripeBits))];
+    }
+
+    static size_t homeSlot(uint64_t tag, size_t mask) { return static_cast<size_t>(tag >> 1) & mask; }
+
+    // Writers hold the exclusive lock, so the version needs no read-modify-write.
+    static void beginWrite(Stripe& stripe) {
+        stripe.version.store(stripe.version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    static void endWrite(Stripe& stripe) {
+        stripe.version.store(stripe.version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Index of the slot holding 'key', or SIZE_MAX. Caller holds the stripe lock.
+     */
+    static size_t findLocked(const SlotArray* array, const Probe& probe, const std::string& key) {
+        if (!array) return SIZE_MAX;
+        for (size_t i = homeSlot(probe.tag, array->mask);; i = (i + 1) & array->mask) {
+            uint64_t tag = array->slots[i].tag.load(std::memory_order_relaxed);
+            if (tag == 0) return SIZE_MAX;
+            if (tag == probe.tag && array->slots[i].key == key) return i;
+        }
+    }
+
+    /**
+     * @brief Seqlock read. Returns false if no consistent snapshot was seen.
+     */
+    bool searchOptimistic(const Stripe& stripe, const Probe& probe, int& value) const {
+        for (int attempt = 0; attempt < OPTIMISTIC_READ_ATTEMPTS; ++attempt) {
+            uint64_t before = stripe.version.load(std::memory_order_acquire);
+            if (before & 1) continue; // a writer is busy
+            const SlotArray* array = stripe.current.load(std::memory_order_acquire);
+            int found = -1;
+            if (array) {
+                // The slots may change under us, so bound the probe instead of trusting an empty slot to come.
+                for (size_t i = homeSlot(probe.tag, array->mask), n = 0; n <= array->mask; i = (i + 1) & array->mask, ++n) {
+                    const Slot& slot = array->slots[i];
+                    uint64_t tag = slot.tag.load(std::memory_order_relaxed);
+                    if (tag == 0) break;
+                    if (tag != probe.tag || slot.length.load(std::memory_order_relaxed) != probe.length) continue;
+                    bool same = true;
+                    for (size_t w = 0; w < KEY_INLINE_WORDS; ++w) {
+                        same &= slot.inlineKey[w].load(std::memory_order_relaxed) == probe.words[w];
+                    }
+                    if (same) {
+                        found = slot.value.load(std::memory_order_relaxed);
+                        break;
+                    }
+                }
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (stripe.version.load(std::memory_order_relaxed) == before) {
+                value = found;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Copies slot 'from' into the empty slot 'to'. Caller is inside beginWrite/endWrite.
+     */
+    static void moveSlot(Slot& to, Slot& from) {
+        to.value.store(from.value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        to.length.store(from.length.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        for (size_t w = 0; w < KEY_INLINE_WORDS; ++w) {
+            to.inlineKey[w].store(from.inlineKey[w].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        to.key = std::move(from.key);
+        to.tag.store(from.tag.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Doubles the stripe's slot array. The new array is filled before it is
+     * published; the old one stays allocated for readers still probing it.
+     */
+    static void growStripe(Stripe& stripe) {
+        SlotArray* old = stripe.current.load(std::memory_order_relaxed);
+        size_t capacity = old ? (old->mask + 1) * 2 : STRIPE_MIN_CAPACITY;
+        stripe.arrays.push_back(std::make_unique<SlotArray>(capacity));
+        SlotArray* grown = stripe.arrays.back().get();
+        if (old) {
+            for (size_t i = 0; i <= old->mask; ++i) {
+                Slot& slot = old->slots[i];
+                uint64_t tag = slot.tag.load(std::memory_order_relaxed);
+                if (tag == 0) continue;
+                size_t j = homeSlot(tag, grown->mask);
+                while (grown->slots[j].tag.load(std::memory_order_relaxed) != 0) j = (j + 1) & grown->mask;
+                moveSlot(grown->slots[j], slot); // the old slot keeps its atomics, only the string moves
+            }
+        }
+        beginWrite(stripe);
+        stripe.current.store(grown, std::memory_order_release);
+        endWrite(stripe);
+    }
+
+public:
+    /**
+     * @brief Creates a table with 'stripeCount' stripes (rounded up to a power of 2).
+     * @param optimisticReads Read without locking where possible; false always takes the shared lock.
+     */
+    explicit ConcurrentHashTable(size_t stripeCount = 64, bool optimisticReads = true, uint64_t seed = randomHashSeed())
+        : stripeBits(0), optimisticReads(optimisticReads), hasher(seed) {
+        while ((size_t(1) << stripeBits) < stripeCount && stripeBits < 16) ++stripeBits;
+        stripes.reset(new Stripe[size_t(1) << stripeBits]);
+    }
+
+    /**
+     * @brief Inserts 'value' if the key is absent, otherwise replaces the stored
+     * value v with update(v). Both happen atomically under the stripe lock.
+     * @return true if the key was inserted.
+     */
+    template <typename Update>
+    bool insertOrUpdate(const std::string& key, int value, Update update) {
+        Probe probe = makeProbe(key);
+        Stripe& stripe = stripeFor(probe.tag);
+        std::unique_lock<std::shared_mutex> guard(stripe.lock);
+        SlotArray* array = stripe.current.load(std::memory_order_relaxed);
+        size_t found = findLocked(array, probe, key);
+        if (found != SIZE_MAX) {
+            // A single atomic store: readers see the old or the new value, never a
+            // mix, so the version does not have to change.
+            std::atomic<int>& stored = array->slots[found].value;
+            stored.store(update(stored.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            return false;
+        }
+        // Keep the stripe at most 3/4 full so probes stay short and always end.
+        if (!array || (stripe.used + 1) * 4 > (array->mask + 1) * 3) {
+            growStripe(stripe);
+            array = stripe.current.load(std::memory_order_relaxed);
+        }
+        size_t i = homeSlot(probe.tag, array->mask);
+        while (array->slots[i].tag.load(std::memory_order_relaxed) != 0) i = (i + 1) & array->mask;
+        Slot& slot = array->slots[i];
+        beginWrite(stripe);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.length.store(probe.length, std::memory_order_relaxed);
+        for (size_t w = 0; w < KEY_INLINE_WORDS; ++w) slot.inlineKey[w].store(probe.words[w], std::memory_order_relaxed);
+        slot.key = key;
+        slot.tag.store(probe.tag, std::memory_order_relaxed);
+        endWrite(stripe);
+        ++stripe.used;
+        return true;
+    }
+
+    /**
+     * @brief Inserts a key-value pair; if the key already exists, its value is updated.
+     */
+    void insert(const std::string& key, int value) {
+        insertOrUpdate(key, value, [value](int) { return value; });
+    }
+
+    /**
+     * @brief Searches for a key and returns its value.
+     * @return The value if the key is found, otherwise -1.
+     */
+    int search(const std::string& key) const {
+        Probe probe = makeProbe(key);
+        Stripe& stripe = stripeFor(probe.tag);
+        int value = -1;
+        if (optimisticReads && key.size() <= KEY_INLINE_BYTES && searchOptimistic(stripe, probe, value)) return value;
+        std::shared_lock<std::shared_mutex> guard(stripe.lock);
+        const SlotArray* array = stripe.current.load(std::memory_order_relaxed);
+        size_t found = findLocked(array, probe, key);
+        return found == SIZE_MAX ? -1 : array->slots[found].value.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Removes a key. Later entries of the probe run are shifted back into
+     * the gap, so no tombstones are needed.
+     * @return true if the key was present.
+     */
+    bool remove(const std::string& key) {
+        Probe probe = makeProbe(key);
+        Stripe& stripe = stripeFor(probe.tag);
+        std::unique_lock<std::shared_mutex> guard(stripe.lock);
+        SlotArray* array = stripe.current.load(std::memory_order_relaxed);
+        size_t gap = findLocked(array, probe, key);
+        if (gap == SIZE_MAX) return false;
+        beginWrite(stripe);
+        for (size_t j = (gap + 1) & array->mask;; j = (j + 1) & array->mask) {
+            uint64_t tag = array->slots[j].tag.load(std::memory_order_relaxed);
+            if (tag == 0) break;
+            // The entry at j may fill the gap unless its home lies between the gap and j.
+            size_t home = homeSlot(tag, array->mask);
+            if (((j - home) & array->mask) >= ((j - gap) & array->mask)) {
+                moveSlot(array->slots[gap], array->slots[j]);
+                gap = j;
+            }
+        }
+        array->slots[gap].tag.store(0, std::memory_order_relaxed);
+        array->slots[gap].key.clear();
+        endWrite(stripe);
+        --stripe.used;
+        return true;
+    }
+
+    size_t size() const {
+        size_t total = 0;
+        for (size_t s = 0; s < (size_t(1) << stripeBits); ++s) {
+            std::shared_lock<std::shared_mutex> guard(stripes[s].lock);
+            total += stripes[s].used;
+        }
+        return total;
+    }
 
-    HashTable ht;
+    size_t stripeCount() const { return size_t(1) << stripeBits; }
+};
 
-    ht.insert("apple", 10);
-    ht.insert("banana", 20);
-    ht.insert("orange", 30);
-    ht.insert("grape", 40); // This might collide with "apple"
-    ht.insert("melon", 50);
+// --- Example ---
+
+/**
+ * @brief Runs the same operations on any table with the insert/search/remove API.
+ */
+template <typename Table>
+static void runHashTableDemo(Table& table) {
+    table.insert("apple", 10);
+    table.insert("banana", 20);
+    table.insert("orange", 30);
+    table.insert("grape", 40); // This might collide with "apple"
+    table.insert("melon", 50);
     std::cout << std::endl;
 
-    ht.display();
+    table.display();
     std::cout << std::endl;
 
-    ht.search("orange");
-    ht.search("grape");
-    ht.search("watermelon");
+    table.search("orange");
+    table.search("grape");
+    table.search("watermelon");
     std::cout << std::endl;
 
-    ht.remove("banana");
-    ht.display();
-}
\ No newline at end of file
+    table.remove("banana");
+    table.display();
+}
+
+/**
+ * @brief Measures every single insert and prints the median, p99 and worst
+ * case. A table that rehashes everything at once shows it in the worst case.
+ */
+static void insertLatencyBenchmark() {
+    const size_t n = 200000;
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < n; ++i) keys.push_back("key" + std::to_string(i * 2654435761u % 1000000007u));
+
+    auto measure = [&](const char* name, auto insertFn) {
+        std::vector<double> ns(n);
+        for (size_t i = 0; i < n; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            insertFn(keys[i], static_cast<int>(i));
+            ns[i] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+        std::sort(ns.begin(), ns.end());
+        std::cout << std::left << std::setw(34) << name << std::right << " | " << std::setw(8) << ns[n / 2] << " | "
+                  << std::setw(8) << ns[n * 99 / 100] << " | " << ns[n - 1] << "\n";
+    };
+
+    std::cout << "\nInsert latency, " << n << " keys (ns)\n";
+    std::cout << "table                              |   median |      p99 | worst\n";
+    HashTable<> chained(false);
+    measure("HashTable (incremental rehash)", [&](const std::string& k, int v) { chained.insert(k, v); });
+    FlatHashTable<> flat(false);
+    measure("FlatHashTable (full rehash)", [&](const std::string& k, int v) { flat.insert(k, v); });
+    std::unordered_map<std::string, int> map;
+    measure("std::unordered_map (full rehash)", [&](const std::string& k, int v) { map[k] = v; });
+    HashTableStats stats = chained.stats();
+    std::cout << "HashTable ended with " << stats.bucketCount << " buckets, load factor " << stats.loadFactor << "\n";
+}
+
+
+/**
+ * @brief Times insert / search hit / search miss / remove on the chained table,
+ * the flat table and std::unordered_map.
+ */
+static void hashTableBenchmark() {
+    const size_t sizes[] = {1000, 10000, 100000, 1000000};
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(1);
+    std::cout << "\nBenchmark: ns per operation (string keys)\n";
+    std::cout << "      keys | operation   | chained HashTable | FlatHashTable | std::unordered_map\n";
+    for (size_t n : sizes) {
+        std::vector<std::string> keys, missing;
+        for (size_t i = 0; i < n; ++i) {
+            keys.push_back("key" + std::to_string(i * 2654435761u % 1000000007u));
+            missing.push_back("nokey" + std::to_string(i));
+        }
+
+        // Each column runs the four phases and reports ns/op per phase.
+        auto run = [&](auto& insertFn, auto& searchFn, auto& removeFn, long long& checksum) {
+            std::vector<double> ns;
+            auto phase = [&](auto body, const std::vector<std::string>& phaseKeys) {
+                auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < phaseKeys.size(); ++i) body(phaseKeys[i], i);
+                ns.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+                             static_cast<double>(phaseKeys.size()));
+            };
+            phase([&](const std::string& k, size_t i) { insertFn(k, static_cast<int>(i)); }, keys);
+            phase([&](const std::string& k, size_t) { checksum += searchFn(k); }, keys);
+            phase([&](const std::string& k, size_t) { checksum += searchFn(k); }, missing);
+            phase([&](const std::string& k, size_t) { removeFn(k); }, keys);
+            return ns;
+        };
+
+        long long chainedSum = 0, flatSum = 0, stdSum = 0;
+        HashTable<> table(false);
+        auto insertFn = [&](const std::string& k, int v) { table.insert(k, v); };
+        auto searchFn = [&](const std::string& k) { return table.search(k); };
+        auto removeFn = [&](const std::string& k) { table.remove(k); };
+        std::vector<double> chained = run(insertFn, searchFn, removeFn, chainedSum);
+
+        FlatHashTable<> flat(false);
+        auto flatInsert = [&](const std::string& k, int v) { flat.insert(k, v); };
+        auto flatSearch = [&](const std::string& k) { return flat.search(k); };
+        auto flatRemove = [&](const std::string& k) { flat.remove(k); };
+        std::vector<double> flatNs = run(flatInsert, flatSearch, flatRemove, flatSum);
+
+        std::unordered_map<std::string, int> map;
+        auto stdInsert = [&](const std::string& k, int v) { map[k] = v; };
+        auto stdSearch = [&](const std::string& k) {
+            auto it = map.find(k);
+            return it == map.end() ? -1 : it->second;
+        };
+        auto stdRemove = [&](const std::string& k) { map.erase(k); };
+        std::vector<double> stdNs = run(stdInsert, stdSearch, stdRemove, stdSum);
+
+        const char* phases[] = {"insert", "search hit", "search miss", "remove"};
+        for (size_t p = 0; p < 4; ++p) {
+            std::cout << std::setw(10) << n << " | " << std::left << std::setw(11) << phases[p] << std::right << " | "
+                      << std::setw(17) << chained[p] << " | " << std::setw(13) << flatNs[p] << " | " << stdNs[p] << "\n";
+        }
+        bool ok = flatSum == stdSum && chainedSum == stdSum && table.stats().size == 0 && flat.size() == 0 && map.empty();
+        if (!ok) std::cout << "(WRONG results for " << n << " keys)\n";
+    }
+    insertLatencyBenchmark();
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+// The usual way to share a map between threads: one mutex around the whole
+// std::unordered_map. Same API as ConcurrentHashTable, for the benchmark.
+struct MutexHashMap {
+    std::mutex lock;
+    std::unordered_map<std::string, int> map;
+
+    template <typename Update>
+    bool insertOrUpdate(const std::string& key, int value, Update update) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto result = map.emplace(key, value);
+        if (!result.second) result.first->second = update(result.first->second);
+        return result.second;
+    }
+    int search(const std::string& key) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = map.find(key);
+        return it == map.end() ? -1 : it->second;
+    }
+    bool remove(const std::string& key) {
+        std::lock_guard<std::mutex> guard(lock);
+        return map.erase(key) > 0;
+    }
+};
+
+/**
+ * @brief Splits 'totalOps' random operations over 'threads' threads, all
+ * started at once: readPercent% searches, the rest half increments (via
+ * insertOrUpdate) and half removes. Returns millions of operations per second.
+ */
+template <typename Table>
+static double runConcurrentMix(Table& table, const std::vector<std::string>& keys, unsigned threads,
+                               unsigned readPercent, size_t totalOps) {
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> go{false};
+    std::atomic<long long> sink{0};
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            uint64_t state = 0x9E3779B97F4A7C15ULL * (t + 1); // xorshift64, one stream per thread
+            long long sum = 0;
+            size_t ops = totalOps / threads;
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (size_t i = 0; i < ops; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                const std::string& key = keys[state % keys.size()];
+                unsigned roll = static_cast<unsigned>((state >> 40) % 100);
+                if (roll < readPercent) {
+                    sum += table.search(key);
+                } else if (roll & 1) {
+                    table.insertOrUpdate(key, 1, [](int v) { return v + 1; });
+                } else {
+                    table.remove(key);
+                }
+            }
+            sink.fetch_add(sum);
+        });
+    }
+    while (ready.load() < threads) std::this_thread::yield();
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(totalOps / threads * threads) / seconds / 1e6;
+}
+
+/**
+ * @brief Throughput of the striped table (with and without optimistic reads)
+ * against a single mutex, from 1 to 64 threads, then a check that concurrent
+ * insertOrUpdate increments are never lost.
+ */
+static void concurrentHashTableBenchmark() {
+    const size_t keyCount = 100000;
+    const size_t totalOps = 2000000;
+    const unsigned threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+    const unsigned readPercents[] = {95, 50};
+
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < keyCount; ++i) keys.push_back("key" + std::to_string(i * 2654435761u % 1000000007u));
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(2);
+    std::cout << "\nConcurrent map: " << totalOps << " operations on " << keyCount << " keys, "
+              << std::max(1u, std::thread::hardware_concurrency()) << " hardware thread(s) (million ops/s)\n";
+    for (unsigned readPercent : readPercents) {
+        std::cout << "\n" << readPercent << "% searches, " << (100 - readPercent) - (100 - readPercent) / 2
+                  << "% increments, " << (100 - readPercent) / 2 << "% removes\n";
+        std::cout << "threads | one mutex + unordered_map | striped, locked reads | striped, optimistic reads\n";
+        for (unsigned threads : threadCounts) {
+            MutexHashMap mutexMap;
+            ConcurrentHashTable<> lockedReads(64, false);
+            ConcurrentHashTable<> optimistic(64, true);
+            for (const std::string& key : keys) {
+                mutexMap.map[key] = 0;
+                lockedReads.insert(key, 0);
+                optimistic.insert(key, 0);
+            }
+            std::cout << std::setw(7) << threads << " | " << std::setw(25)
+                      << runConcurrentMix(mutexMap, keys, threads, readPercent, totalOps) << " | " << std::setw(21)
+                      << runConcurrentMix(lockedReads, keys, threads, readPercent, totalOps) << " | "
+                      << runConcurrentMix(optimistic, keys, threads, readPercent, totalOps) << "\n";
+        }
+    }
+
+    // Every increment must land exactly once, however the threads interleave.
+    const unsigned threads = 64;
+    const int incrementsPerThread = 20000;
+    ConcurrentHashTable<> counters;
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (int i = 0; i < incrementsPerThread; ++i) {
+                counters.insertOrUpdate(keys[(t * 7919u + static_cast<unsigned>(i)) % 1000], 1,
+                                        [](int v) { return v + 1; });
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    long long total = 0;
+    for (size_t i = 0; i < 1000; ++i) total += std::max(0, counters.search(keys[i]));
+    long long expected = static_cast<long long>(threads) * incrementsPerThread;
+    std::cout << "\ninsertOrUpdate: " << threads << " threads x " << incrementsPerThread << " increments -> total "
+              << total << " (expected " << expected << ")" << (total == expected ? "" : " (WRONG)") << "\n";
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+/**
+ * @brief Loads 'keys' into a quiet chained table and prints how long its
+ * chains are. Lengths are grouped 0, 1, 2, 3, 4-7, 8-15, ... so that one
+ * report fits both a good hash and a badly clustered one.
+ */
+template <typename Hasher>
+static void printChainHistogram(const char* name, const std::vector<std::string>& keys) {
+    HashTable<Hasher> table(false);
+    for (size_t i = 0; i < keys.size(); ++i) table.insert(keys[i], static_cast<int>(i));
+    std::vector<size_t> histogram = table.chainLengthHistogram();
+    HashTableStats stats = table.stats();
+
+    // Keys compared by a successful search: a chain of length k costs 1 + 2 + ... + k in total.
+    double compares = 0;
+    size_t buckets = 0;
+    for (size_t length = 0; length < histogram.size(); ++length) {
+        compares += static_cast<double>(histogram[length]) * static_cast<double>(length * (length + 1) / 2);
+        buckets += histogram[length];
+    }
+    std::cout << "\n" << name << ": " << stats.size << " keys in " << buckets << " buckets, longest chain "
+              << histogram.size() - 1 << ", " << compares / std::max<size_t>(stats.size, 1)
+              << " key compares per successful search\n";
+    std::cout << "  chain length |  buckets | % of keys\n";
+    for (size_t low = 0; low < histogram.size(); low = low < 4 ? low + 1 : low * 2) {
+        size_t high = low < 4 ? low : std::min(low * 2, histogram.size()) - 1;
+        size_t bucketCount = 0, keyCount = 0;
+        for (size_t length = low; length <= high; ++length) {
+            bucketCount += histogram[length];
+            keyCount += histogram[length] * length;
+        }
+        if (bucketCount == 0) continue;
+        std::string label = low == high ? std::to_string(low) : std::to_string(low) + "-" + std::to_string(high);
+        std::cout << "  " << std::setw(12) << label << " | " << std::setw(8) << bucketCount << " | " << std::setw(8)
+                  << 100.0 * static_cast<double>(keyCount) / static_cast<double>(std::max<size_t>(stats.size, 1))
+                  << "%\n";
+    }
+}
+
+/**
+ * @brief Hash flooding check. The keys start with wyhash's public mixing
+ * constant, so a hash that XORs key bytes with that constant before a multiply
+ * (instead of a secret taken from the seed) maps the 12-byte keys all to one
+ * value and forgets its seed on the 32-byte ones. The seeded hash must spread
+ * them out under every seed.
+ */
+static void craftedKeyCheck() {
+    const uint64_t publicConstant = 0xe7037ed1a0b428dbULL;
+    const uint32_t keyCount = 5000;
+    std::vector<std::string> shortKeys, longKeys;
+    for (uint32_t i = 0; i < keyCount; ++i) {
+        // Keys of 4..16 bytes are read as (bytes 0-3 << 32) | bytes 4-7.
+        uint32_t high = static_cast<uint32_t>(publicConstant >> 32), low = static_cast<uint32_t>(publicConstant);
+        std::string key(12, '\0');
+        std::memcpy(&key[0], &high, 4);
+        std::memcpy(&key[4], &low, 4);
+        std::memcpy(&key[8], &i, 4);
+        shortKeys.push_back(key);
+        std::string longKey(32, '\0');
+        std::memcpy(&longKey[0], &publicConstant, 8);
+        std::memcpy(&longKey[16], &i, 4);
+        longKeys.push_back(longKey);
+    }
+
+    std::cout << "\nCrafted keys: " << keyCount << " 12-byte keys starting with a public hash constant\n";
+    bool ok = true;
+    for (int table = 1; table <= 3; ++table) {
+        HashTable<> chained(false);
+        for (uint32_t i = 0; i < keyCount; ++i) chained.insert(shortKeys[i], static_cast<int>(i));
+        size_t longest = chained.chainLengthHistogram().size() - 1;
+        ok &= longest <= 16;
+        std::cout << "  table " << table << " (own random seed): longest chain " << longest << "\n";
+    }
+    FastStringHasher first(randomHashSeed()), second(randomHashSeed());
+    size_t equal = 0;
+    for (const std::string& key : longKeys) equal += first(key) == second(key);
+    ok &= equal == 0;
+    std::cout << "  32-byte variants hashing the same under two seeds: " << equal << (ok ? "" : " (WRONG)") << "\n";
+}
+
+/**
+ * @brief Compares the additive and the seeded hash on one key set: either the
+ * lines of a file or, for an empty path, generated keys.
+ */
+static void hashQualityReport() {
+    std::cout << "\nKey file, one key per line (empty = generated keys): ";
+    std::string path;
+    std::getline(std::cin, path);
+
+    std::vector<std::string> keys;
+    if (path.empty()) {
+        for (int i = 0; i < 100000; ++i) keys.push_back("user" + std::to_string(i));
+    } else {
+        std::ifstream in(path);
+        if (!in) {
+            std::cerr << "Error opening file for reading: " << path << std::endl;
+            return;
+        }
+        std::string line;
+        while (std::getline(in, line)) keys.push_back(line);
+    }
+
+    AdditiveHasher additive(0);
+    FastStringHasher fast(randomHashSeed());
+    std::cout << "\nAnagrams: additive hash of \"apple\" = " << additive("apple") << ", of \"ppale\" = "
+              << additive("ppale") << "\n";
+    std::cout << "          seeded hash of \"apple\" = " << fast("apple") << ", of \"ppale\" = " << fast("ppale") << "\n";
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(1);
+    printChainHistogram<AdditiveHasher>("Additive hash", keys);
+    printChainHistogram<FastStringHasher>("Seeded fast hash", keys);
+    craftedKeyCheck();
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+/**
+ * @brief Inserts keys one by one and shows the table growing while the old
+ * bucket array is drained a few buckets per operation.
+ */
+static void growthDemo() {
+    HashTable<> table(false);
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(2);
+    std::cout << "\n  keys | buckets | load factor | migration\n";
+    for (int i = 1; i <= 200; ++i) {
+        table.insert("item" + std::to_string(i), i);
+        HashTableStats stats = table.stats();
+        if (i % 10 == 0 || stats.oldBucketCount != 0) {
+            std::cout << std::setw(6) << stats.size << " | " << std::setw(7) << stats.bucketCount << " | "
+                      << std::setw(11) << stats.loadFactor << " | ";
+            if (stats.oldBucketCount == 0) {
+                std::cout << "-\n";
+            } else {
+                std::cout << stats.migratedBuckets << "/" << stats.oldBucketCount << " old buckets moved\n";
+            }
+        }
+    }
+
+    // The point of incremental growth: no single insert pays for a whole
+    // resize. Time every insert and report the worst one per table size.
+    const size_t n = 3000000;
+    HashTable<> large(false);
+    std::cout << "\nWorst single insert while growing to " << n << " keys\n";
+    std::cout << "   buckets | keys when full | worst insert (us)\n";
+    double worst = 0, overall = 0;
+    size_t buckets = large.stats().bucketCount;
+    for (size_t i = 0; i < n; ++i) {
+        std::string key = "key" + std::to_string(i);
+        auto start = std::chrono::steady_clock::now();
+        large.insert(key, static_cast<int>(i));
+        worst = std::max(worst, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+        HashTableStats stats = large.stats();
+        if (stats.bucketCount != buckets || i + 1 == n) {
+            if (buckets >= 10000) {
+                std::cout << std::setw(10) << buckets << " | " << std::setw(14) << i + 1 << " | " << worst << "\n";
+            }
+            overall = std::max(overall, worst);
+            worst = 0;
+            buckets = stats.bucketCount;
+        }
+    }
+    std::cout << "Worst single insert overall: " << overall << " us\n";
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+void hash_table_data_structureEx(void) {
+    printLine("Hash Table Data Structure Example");
+
+    int choice = 0;
+    while (choice != 7) {
+        std::cout << "\n--- Hash Table Menu ---\n";
+        std::cout << "1. Chained hash table (vector of lists)\n";
+        std::cout << "2. Flat hash table (open addressing, SIMD group probing)\n";
+        std::cout << "3. Benchmark: chained vs flat vs std::unordered_map\n";
+        std::cout << "4. Growth: load factor and incremental rehash statistics\n";
+        std::cout << "5. Hash quality: chain-length histogram, additive vs seeded hash\n";
+        std::cout << "6. Concurrent hash table: lock striping, 1-64 thread scaling\n";
+        std::cout << "7. Back to main menu\n";
+        std::cout << "Enter your choice: ";
+        std::cin >> choice;
+
+        if (std::cin.fail() || choice < 1 || choice > 7) {
+            std::cout << "\nInvalid input. Please enter a number between 1 and 7.\n";
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            continue;
+        }
+
+        if (choice == 1) {
+            HashTable<> ht;
+            runHashTableDemo(ht);
+        } else if (choice == 2) {
+            FlatHashTable<> ht;
+            runHashTableDemo(ht);
+        } else if (choice == 3) {
+            hashTableBenchmark();
+        } else if (choice == 4) {
+            growthDemo();
+        } else if (choice == 5) {
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            hashQualityReport();
+        } else if (choice == 6) {
+            concurrentHashTableBenchmark();
+        }
+    }
+}
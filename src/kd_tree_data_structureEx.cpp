@@ -0,0 +1,310 @@
+#include <iostream>
+#include <vector>
+#include <algorithm> // For std::nth_element, std::push_heap
+#include <limits>    // For std::numeric_limits
+#include <thread>    // For the parallel build
+#include <chrono>    // For the benchmark
+#include <random>    // For std::mt19937
+#include <iomanip>   // For std::setw (benchmark tables)
+#include "helloEx.h" // for printLine
+#include "kd_tree_data_structureEx.h"
+
+// --- k-d Tree ---
+//
+// A binary search tree that splits space instead of numbers: the root splits
+// the points at the median x, its children split their halves at the median y,
+// and so on. A query only descends into the side of a split that can still
+// hold an answer, so a nearest-neighbour search visits O(log n) nodes on
+// typical data instead of scanning all n points.
+//
+// The tree is built once by median split (std::nth_element, O(n) per level).
+// The two halves of a split are independent, so the top levels are built on
+// separate threads. Ranges of at most KD_LEAF_SIZE points are leaves that are
+// scanned linearly, which is faster than descending into single points.
+
+const size_t KD_LEAF_SIZE = 8;
+
+static inline float squaredDistance(Vector2D a, Vector2D b) {
+    float dx = a.x - b.x;
+    float dy = a.y - b.y;
+    return dx * dx + dy * dy;
+}
+
+static inline float coordinate(Vector2D p, unsigned axis) {
+    return axis == 0 ? p.x : p.y;
+}
+
+KdTree::KdTree(const std::vector<Vector2D>& points, unsigned numThreads) {
+    entries.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        entries[i] = {points[i], static_cast<uint32_t>(i)};
+    }
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // Levels 0..parallelDepth-1 hand one half to a new thread: 2^parallelDepth >= numThreads.
+    unsigned parallelDepth = 0;
+    while ((1u << parallelDepth) < numThreads) ++parallelDepth;
+    build(0, entries.size(), 0, parallelDepth);
+}
+
+void KdTree::build(size_t lo, size_t hi, unsigned depth, unsigned parallelDepth) {
+    if (hi - lo <= KD_LEAF_SIZE) return;
+    size_t mid = lo + (hi - lo) / 2;
+    unsigned axis = depth % 2;
+    // Left of mid: coordinate <= median; right of mid: coordinate >= median.
+    std::nth_element(entries.begin() + lo, entries.begin() + mid, entries.begin() + hi,
+                     [axis](const Entry& a, const Entry& b) {
+                         return coordinate(a.point, axis) < coordinate(b.point, axis);
+                     });
+    if (depth < parallelDepth) {
+        std::thread left(&KdTree::build, this, lo, mid, depth + 1, parallelDepth);
+        build(mid + 1, hi, depth + 1, parallelDepth);
+        left.join();
+    } else {
+        build(lo, mid, depth + 1, parallelDepth);
+        build(mid + 1, hi, depth + 1, parallelDepth);
+    }
+}
+
+void KdTree::nearestIn(size_t lo, size_t hi, unsigned depth, Vector2D query, float& bestDistance,
+                       size_t& best) const {
+    if (hi - lo <= KD_LEAF_SIZE) {
+        for (size_t i = lo; i < hi; ++i) {
+            float d = squaredDistance(entries[i].point, query);
+            if (d < bestDistance) {
+                bestDistance = d;
+                best = entries[i].index;
+            }
+        }
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    const Entry& node = entries[mid];
+    float d = squaredDistance(node.point, query);
+    if (d < bestDistance) {
+        bestDistance = d;
+        best = node.index;
+    }
+    // Search the side of the split that holds the query first; the other side
+    // only matters if the splitting line is closer than the best point so far.
+    float diff = coordinate(query, depth % 2) - coordinate(node.point, depth % 2);
+    if (diff < 0) {
+        nearestIn(lo, mid, depth + 1, query, bestDistance, best);
+        if (diff * diff < bestDistance) nearestIn(mid + 1, hi, depth + 1, query, bestDistance, best);
+    } else {
+        nearestIn(mid + 1, hi, depth + 1, query, bestDistance, best);
+        if (diff * diff < bestDistance) nearestIn(lo, mid, depth + 1, query, bestDistance, best);
+    }
+}
+
+size_t KdTree::nearest(Vector2D query) const {
+    float bestDistance = std::numeric_limits<float>::infinity();
+    size_t best = entries.size();
+    nearestIn(0, entries.size(), 0, query, bestDistance, best);
+    return best;
+}
+
+/**
+ * @brief Offers one point to the max-heap of the k closest points found so far.
+ */
+static inline void offerCandidate(std::vector<std::pair<float, uint32_t>>& heap, size_t k, float distance,
+                                  uint32_t index) {
+    if (heap.size() < k) {
+        heap.emplace_back(distance, index);
+        std::push_heap(heap.begin(), heap.end());
+    } else if (distance < heap.front().first) {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = {distance, index};
+        std::push_heap(heap.begin(), heap.end());
+    }
+}
+
+void KdTree::kNearestIn(size_t lo, size_t hi, unsigned depth, Vector2D query, size_t k,
+                        std::vector<std::pair<float, uint32_t>>& heap) const {
+    if (hi - lo <= KD_LEAF_SIZE) {
+        for (size_t i = lo; i < hi; ++i) {
+            offerCandidate(heap, k, squaredDistance(entries[i].point, query), entries[i].index);
+        }
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    const Entry& node = entries[mid];
+    offerCandidate(heap, k, squaredDistance(node.point, query), node.index);
+
+    float diff = coordinate(query, depth % 2) - coordinate(node.point, depth % 2);
+    size_t nearLo = diff < 0 ? lo : mid + 1, nearHi = diff < 0 ? mid : hi;
+    size_t farLo = diff < 0 ? mid + 1 : lo, farHi = diff < 0 ? hi : mid;
+    kNearestIn(nearLo, nearHi, depth + 1, query, k, heap);
+    if (heap.size() < k || diff * diff < heap.front().first) {
+        kNearestIn(farLo, farHi, depth + 1, query, k, heap);
+    }
+}
+
+std::vector<size_t> KdTree::kNearest(Vector2D query, size_t k) const {
+    std::vector<std::pair<float, uint32_t>> heap;
+    if (k == 0) return {};
+    heap.reserve(k);
+    kNearestIn(0, entries.size(), 0, query, k, heap);
+    std::sort_heap(heap.begin(), heap.end()); // ascending distance
+    std::vector<size_t> result;
+    for (const auto& candidate : heap) result.push_back(candidate.second);
+    return result;
+}
+
+void KdTree::rangeIn(size_t lo, size_t hi, unsigned depth, Vector2D low, Vector2D high,
+                     std::vector<size_t>& out) const {
+    auto inside = [&](Vector2D p) { return p.x >= low.x && p.x <= high.x && p.y >= low.y && p.y <= high.y; };
+    if (hi - lo <= KD_LEAF_SIZE) {
+        for (size_t i = lo; i < hi; ++i) {
+            if (inside(entries[i].point)) out.push_back(entries[i].index);
+        }
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    const Entry& node = entries[mid];
+    if (inside(node.point)) out.push_back(node.index);
+    unsigned axis = depth % 2;
+    float split = coordinate(node.point, axis);
+    if (coordinate(low, axis) <= split) rangeIn(lo, mid, depth + 1, low, high, out);
+    if (coordinate(high, axis) >= split) rangeIn(mid + 1, hi, depth + 1, low, high, out);
+}
+
+std::vector<size_t> KdTree::rangeQuery(Vector2D low, Vector2D high) const {
+    std::vector<size_t> out;
+    rangeIn(0, entries.size(), 0, low, high, out);
+    return out;
+}
+
+// --- Example ---
+
+/**
+ * @brief Times the tree against brute-force scans on 10^7 random points.
+ */
+static void kdTreeBenchmark() {
+    const size_t n = 10000000;
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<Vector2D> points(n);
+    for (Vector2D& p : points) p = {unit(rng), unit(rng)};
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(2);
+    std::cout << "\nBenchmark: " << n << " random points in the unit square\n";
+    auto start = std::chrono::steady_clock::now();
+    { KdTree sequential(points, 1); }
+    double sequentialMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    KdTree tree(points, threads);
+    double parallelMs = elapsedMs(start);
+    std::cout << "build: " << sequentialMs << " ms on 1 thread, " << parallelMs << " ms on " << threads
+              << " thread(s)\n";
+
+    const size_t bruteQueries = 20;
+    const size_t treeQueries = 100000;
+    std::vector<Vector2D> queries(treeQueries);
+    for (Vector2D& q : queries) q = {unit(rng), unit(rng)};
+
+    // Nearest neighbour: compare distances, since equally close points may differ.
+    bool ok = true;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < bruteQueries; ++q) {
+        float best = std::numeric_limits<float>::infinity();
+        for (const Vector2D& p : points) best = std::min(best, squaredDistance(p, queries[q]));
+        ok = ok && squaredDistance(points[tree.nearest(queries[q])], queries[q]) == best;
+    }
+    double bruteNearestUs = elapsedMs(start) * 1000 / bruteQueries;
+    start = std::chrono::steady_clock::now();
+    size_t checksum = 0;
+    for (const Vector2D& q : queries) checksum += tree.nearest(q);
+    double treeNearestUs = elapsedMs(start) * 1000 / treeQueries;
+
+    // k nearest (k = 10): the brute-force version keeps a partial sort.
+    const size_t k = 10;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < bruteQueries; ++q) {
+        std::vector<float> distances(n);
+        for (size_t i = 0; i < n; ++i) distances[i] = squaredDistance(points[i], queries[q]);
+        std::nth_element(distances.begin(), distances.begin() + (k - 1), distances.end());
+        std::vector<size_t> found = tree.kNearest(queries[q], k);
+        ok = ok && found.size() == k && squaredDistance(points[found.back()], queries[q]) == distances[k - 1];
+    }
+    double bruteKnnUs = elapsedMs(start) * 1000 / bruteQueries;
+    start = std::chrono::steady_clock::now();
+    for (const Vector2D& q : queries) checksum += tree.kNearest(q, k).front();
+    double treeKnnUs = elapsedMs(start) * 1000 / treeQueries;
+
+    // Range: boxes of 0.01 x 0.01 (about 1000 points each).
+    const float side = 0.01f;
+    start = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < bruteQueries; ++q) {
+        Vector2D low = queries[q], high = {queries[q].x + side, queries[q].y + side};
+        size_t count = 0;
+        for (const Vector2D& p : points) {
+            count += p.x >= low.x && p.x <= high.x && p.y >= low.y && p.y <= high.y;
+        }
+        ok = ok && tree.rangeQuery(low, high).size() == count;
+    }
+    double bruteRangeUs = elapsedMs(start) * 1000 / bruteQueries;
+    start = std::chrono::steady_clock::now();
+    for (const Vector2D& q : queries) checksum += tree.rangeQuery(q, {q.x + side, q.y + side}).size();
+    double treeRangeUs = elapsedMs(start) * 1000 / treeQueries;
+
+    std::cout << "query           | brute force (us) | k-d tree (us)\n";
+    std::cout << "nearest         | " << std::setw(16) << bruteNearestUs << " | " << treeNearestUs << "\n";
+    std::cout << "10 nearest      | " << std::setw(16) << bruteKnnUs << " | " << treeKnnUs << "\n";
+    std::cout << "range 0.01^2    | " << std::setw(16) << bruteRangeUs << " | " << treeRangeUs << "\n";
+    std::cout << (ok ? "Results match brute force." : "Results DIFFER from brute force!") << " (checksum "
+              << checksum << ")\n";
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+/**
+ * @brief Builds a tree over a few points and runs each query on it.
+ */
+static void kdTreeDemo() {
+    std::vector<Vector2D> points = {{2.0f, 3.0f}, {5.0f, 4.0f}, {9.0f, 6.0f}, {4.0f, 7.0f}, {8.0f, 1.0f},
+                                    {7.0f, 2.0f}, {1.0f, 9.0f}, {6.0f, 8.0f}, {3.0f, 1.0f}, {9.5f, 9.5f},
+                                    {0.5f, 0.5f}, {5.5f, 5.5f}};
+    KdTree tree(points);
+    auto printPoint = [&](size_t i) { std::cout << " (" << points[i].x << ", " << points[i].y << ")"; };
+
+    std::cout << "Points:";
+    for (size_t i = 0; i < points.size(); ++i) printPoint(i);
+    Vector2D query = {6.0f, 5.0f};
+    std::cout << "\nNearest to (6, 5):";
+    printPoint(tree.nearest(query));
+    std::cout << "\n3 nearest to (6, 5):";
+    for (size_t i : tree.kNearest(query, 3)) printPoint(i);
+    std::cout << "\nIn the box (2, 2)-(7, 8):";
+    for (size_t i : tree.rangeQuery({2.0f, 2.0f}, {7.0f, 8.0f})) printPoint(i);
+    std::cout << "\n";
+}
+
+void kd_tree_data_structureEx(void) {
+    printLine("k-d Tree Example");
+
+    int choice = 0;
+    while (choice != 3) {
+        std::cout << "\n--- k-d Tree Menu ---\n";
+        std::cout << "1. Nearest / k-nearest / range queries on a small point set\n";
+        std::cout << "2. Benchmark: k-d tree vs brute force on 10^7 points\n";
+        std::cout << "3. Back to main menu\n";
+        std::cout << "Enter your choice: ";
+        std::cin >> choice;
+
+        if (std::cin.fail() || choice < 1 || choice > 3) {
+            std::cout << "\nInvalid input. Please enter a number between 1 and 3.\n";
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            continue;
+        }
+
+        if (choice == 1) kdTreeDemo();
+        if (choice == 2) kdTreeBenchmark();
+    }
+}
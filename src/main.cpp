@@ -38,6 +38,8 @@
 #include "polymorphismEx.h"
 #include "socket_programmingEx.h"
 #include "multithreadingEx.h"
+#include "text_searchEx.h"
+#include "kd_tree_data_structureEx.h"
 
 // To build and run this project in VSCode on macOS,
 //    press Cmd+Shift+B to build, 
@@ -102,6 +104,8 @@ MenuItem menu_items[] = {
     {"Networking Basics Example", networking_basicsEx},                      // Example function from networking_basicsEx.cpp
     {"Multithreading Example", multithreadingEx},                            // Example function from multithreadingEx.cpp
     {"Task Management (Smart Pointers)", task_management_using_smart_pointerEx}, // Example function from task_management_using_smart_pointerEx.cpp
+    {"Text Search Example", text_searchEx},                                  // Example function from text_searchEx.cpp
+    {"k-d Tree Example", kd_tree_data_structureEx},                          // Example function from kd_tree_data_structureEx.cpp
     {"*** Snake Game Example", snake_gameEx},                                     // Example function from snake_gameEx.cpp
     {"*** Tetris Game Example", tetris_gameEx}                                      // Example function from tetris_gameEx.cpp
 };
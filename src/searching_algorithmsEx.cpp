@@ -1,8 +1,17 @@
 #include <iostream>
 #include <vector>
+#include <string>
 #include <algorithm> // For std::sort
 #include <limits>    // For std::numeric_limits
+#include <cstdint>   // For uintptr_t
+#include <chrono>    // For the benchmarks
+#include <random>    // For std::mt19937
+#include <iomanip>   // For std::setw (benchmark tables)
+#include <thread>    // For parallelLinearSearch
+#include <atomic>
 #include "helloEx.h" // for printLine
+#include "cpu_featuresEx.h" // prefetchRead
+#include "simd_searchEx.h"   // SIMD linear search kernels
 #include "searching_algorithmsEx.h"
 
 /**
@@ -49,6 +58,761 @@ int binarySearch(const std::vector<int>& arr, int target) {
     return -1; // Not found
 }
 
+// --- Eytzinger layout (cache-friendly binary search) ---
+//
+// binarySearch probes the middle, then a quarter, then an eighth... of the
+// array: every probe on a big array lands on a different cache line, and the
+// CPU cannot fetch the next one before the comparison is done.
+// The Eytzinger layout stores the implicit search tree in BFS order
+// (root at 1, children of k at 2k and 2k+1):
+// - the top levels, which every search visits, are packed into a few hot lines,
+// - the descent 'k = 2k + (key < target)' has no branch to mispredict,
+// - the 16 descendants four levels below k are contiguous (one 64-byte line),
+//   so the search prefetches them while it works on the current level.
+
+const size_t EYTZINGER_PREFETCH_NODES = 16; // ints per 64-byte cache line
+const size_t CACHE_LINE_BYTES = 64;
+
+/**
+ * @brief Number of trailing 1 bits of k.
+ */
+static inline unsigned trailingOnes(size_t k) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(~static_cast<unsigned long long>(k)));
+#else
+    unsigned n = 0;
+    while (k & 1) {
+        k >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief floor(log2(k)) for k >= 1.
+ */
+static inline unsigned floorLog2(size_t k) {
+#if defined(__GNUC__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(static_cast<unsigned long long>(k)));
+#else
+    unsigned n = 0;
+    while (k >>= 1) ++n;
+    return n;
+#endif
+}
+
+EytzingerIndex::EytzingerIndex(const std::vector<int>& sorted) : count(sorted.size()) {
+    // Pad so that keys() starts on a cache line; then node 16k starts one too.
+    const size_t padInts = CACHE_LINE_BYTES / sizeof(int);
+    storage.assign(count + 1 + padInts, std::numeric_limits<int>::max());
+    uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+    keysOffset = ((CACHE_LINE_BYTES - address % CACHE_LINE_BYTES) % CACHE_LINE_BYTES) / sizeof(int);
+
+    if (count == 0) return;
+    levels = floorLog2(count) + 1;
+    for (size_t k = 1; k <= count; ++k) {
+        storage[keysOffset + k] = sorted[sortedPosition(k)];
+    }
+}
+
+/**
+ * @brief Index in the sorted vector of Eytzinger node k (its in-order rank).
+ * Computed, not stored: in a perfect tree the rank follows from k's depth and
+ * offset; every node missing from the partial last level that would come
+ * earlier in order is then subtracted. Saves an array and a cache miss per query.
+ */
+size_t EytzingerIndex::sortedPosition(size_t k) const {
+    unsigned depth = floorLog2(k);
+    size_t offset = k - (size_t(1) << depth);
+    size_t perfectRank = ((2 * offset + 1) << (levels - 1 - depth)) - 1;
+
+    size_t lastLevelNodes = count - ((size_t(1) << (levels - 1)) - 1);
+    size_t leavesBefore = (perfectRank + 1) / 2; // last-level slots in order before this node
+    size_t missingBefore = leavesBefore > lastLevelNodes ? leavesBefore - lastLevelNodes : 0;
+    return perfectRank - missingBefore;
+}
+
+size_t EytzingerIndex::descend(int target, bool upper) const {
+    const int* base = keys();
+    uintptr_t baseAddress = reinterpret_cast<uintptr_t>(base);
+    size_t k = 1;
+    while (k <= count) {
+        prefetchRead(reinterpret_cast<const void*>(baseAddress + k * EYTZINGER_PREFETCH_NODES * sizeof(int)));
+        bool goRight = upper ? base[k] <= target : base[k] < target;
+        k = 2 * k + goRight;
+    }
+    // k is now one step below a leaf. The answer is the node where the path
+    // last turned left: drop the trailing right turns (1 bits) and that turn.
+    return k >> (trailingOnes(k) + 1);
+}
+
+size_t EytzingerIndex::lowerBound(int target) const {
+    size_t k = descend(target, false);
+    return k == 0 ? count : sortedPosition(k);
+}
+
+size_t EytzingerIndex::upperBound(int target) const {
+    size_t k = descend(target, true);
+    return k == 0 ? count : sortedPosition(k);
+}
+
+int EytzingerIndex::find(int target) const {
+    size_t k = descend(target, false);
+    if (k == 0 || keys()[k] != target) return -1;
+    return static_cast<int>(sortedPosition(k));
+}
+
+/**
+ * @brief Times binarySearch, std::lower_bound and EytzingerIndex on arrays that
+ * fit in L1/L2, in L3 and only in RAM.
+ */
+static void eytzingerBenchmark() {
+    const size_t sizes[] = {10000, 1000000, 10000000, 100000000};
+    const size_t queries = 1000000;
+    std::mt19937 rng(14);
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nBenchmark: " << queries << " random lookups, ns per query (half are hits)\n";
+    std::cout << "       size | binarySearch | std::lower_bound | Eytzinger lowerBound | Eytzinger find\n";
+    for (size_t n : sizes) {
+        std::vector<int> sorted(n);
+        for (size_t i = 0; i < n; ++i) sorted[i] = static_cast<int>(2 * i); // even numbers only
+        std::vector<int> targets(queries);
+        for (int& t : targets) t = static_cast<int>(rng() % (2 * n));
+
+        EytzingerIndex index(sorted);
+
+        // Every variant sums its results so the compiler cannot drop the work.
+        auto timeQueries = [&](auto search) {
+            auto start = std::chrono::steady_clock::now();
+            long long checksum = 0;
+            for (int t : targets) checksum += search(t);
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            return std::make_pair(ns / queries, checksum);
+        };
+        auto binary = timeQueries([&](int t) { return binarySearch(sorted, t); });
+        auto stl = timeQueries([&](int t) {
+            return static_cast<long long>(std::lower_bound(sorted.begin(), sorted.end(), t) - sorted.begin());
+        });
+        auto eytzLower = timeQueries([&](int t) { return static_cast<long long>(index.lowerBound(t)); });
+        auto eytzFind = timeQueries([&](int t) { return index.find(t); });
+
+        bool ok = stl.second == eytzLower.second && binary.second == eytzFind.second;
+        std::cout << std::setw(11) << n << " | " << std::setw(12) << binary.first << " | " << std::setw(16)
+                  << stl.first << " | " << std::setw(20) << eytzLower.first << " | " << eytzFind.first
+                  << (ok ? "" : " (WRONG)") << "\n";
+    }
+}
+
+// --- Static B-tree (S-tree) ---
+//
+// A B+ tree whose nodes hold 16 sorted keys, i.e. exactly one 64-byte cache
+// line (two AVX2 registers). Each node is searched with two vector compares
+// instead of four dependent comparisons, so a lookup reads only about
+// log17(n) cache lines where the Eytzinger layout reads log2(n) nodes.
+// The tree never changes after it is built, so it needs no pointers:
+// - layer 0 is the root, the last layer holds all keys in sorted order,
+// - child c of node k lives at k * 17 + c in the next layer,
+// - key j of an internal node is the smallest key under child j + 1.
+// Unused key slots are INT_MAX, which never counts as "<= target" below.
+
+const size_t STREE_NODE_KEYS = 16; // 16 ints = one cache line
+const size_t STREE_FANOUT = STREE_NODE_KEYS + 1;
+
+/**
+ * @brief Number of keys <= target in one sorted 16-key node.
+ */
+static inline size_t sTreeCountScalar(const int* node, int target) {
+    size_t c = 0;
+    for (size_t i = 0; i < STREE_NODE_KEYS; ++i) {
+        c += (node[i] <= target);
+    }
+    return c;
+}
+
+static size_t sTreeDescendScalar(const int* keys, const size_t* layerOffsets, size_t layers, int target) {
+    size_t k = 0;
+    for (size_t h = 0; h + 1 < layers; ++h) {
+        k = k * STREE_FANOUT + sTreeCountScalar(keys + layerOffsets[h] + k * STREE_NODE_KEYS, target);
+    }
+    return k * STREE_NODE_KEYS + sTreeCountScalar(keys + layerOffsets[layers - 1] + k * STREE_NODE_KEYS, target);
+}
+
+#if SIMD_X86
+
+TARGET_AVX2 static inline size_t sTreeCountAVX2(const int* node, __m256i target) {
+    __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(node));
+    __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(node + 8));
+    unsigned greater = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, target)))) |
+                       (static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b, target)))) << 8);
+    // The node is sorted, so the keys > target are a suffix: count the prefix.
+    return static_cast<size_t>(__builtin_ctz(greater | (1u << STREE_NODE_KEYS)));
+}
+
+TARGET_AVX2 static size_t sTreeDescendAVX2(const int* keys, const size_t* layerOffsets, size_t layers, int target) {
+    __m256i t = _mm256_set1_epi32(target);
+    size_t k = 0;
+    for (size_t h = 0; h + 1 < layers; ++h) {
+        k = k * STREE_FANOUT + sTreeCountAVX2(keys + layerOffsets[h] + k * STREE_NODE_KEYS, t);
+    }
+    return k * STREE_NODE_KEYS + sTreeCountAVX2(keys + layerOffsets[layers - 1] + k * STREE_NODE_KEYS, t);
+}
+
+TARGET_SSE41 static inline size_t sTreeCountSSE41(const int* node, __m128i target) {
+    unsigned greater = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(node + 4 * i));
+        greater |= static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, target)))) << (4 * i);
+    }
+    return static_cast<size_t>(__builtin_ctz(greater | (1u << STREE_NODE_KEYS)));
+}
+
+TARGET_SSE41 static size_t sTreeDescendSSE41(const int* keys, const size_t* layerOffsets, size_t layers, int target) {
+    __m128i t = _mm_set1_epi32(target);
+    size_t k = 0;
+    for (size_t h = 0; h + 1 < layers; ++h) {
+        k = k * STREE_FANOUT + sTreeCountSSE41(keys + layerOffsets[h] + k * STREE_NODE_KEYS, t);
+    }
+    return k * STREE_NODE_KEYS + sTreeCountSSE41(keys + layerOffsets[layers - 1] + k * STREE_NODE_KEYS, t);
+}
+
+#endif // SIMD_X86
+
+using STreeDescendFn = size_t (*)(const int*, const size_t*, size_t, int);
+
+static STreeDescendFn selectSTreeDescend() {
+#if SIMD_X86
+    if (cpuHasAVX2()) return sTreeDescendAVX2;
+    if (cpuHasSSE41()) return sTreeDescendSSE41;
+#endif
+    return sTreeDescendScalar;
+}
+
+STreeIndex::STreeIndex(const std::vector<int>& sorted) : count(sorted.size()) {
+    // Node counts per layer, built bottom-up and then reversed (root first).
+    std::vector<size_t> layerNodes = {std::max<size_t>(1, (count + STREE_NODE_KEYS - 1) / STREE_NODE_KEYS)};
+    while (layerNodes.back() > 1) {
+        layerNodes.push_back((layerNodes.back() + STREE_FANOUT - 1) / STREE_FANOUT);
+    }
+    std::reverse(layerNodes.begin(), layerNodes.end());
+
+    size_t totalInts = 0;
+    for (size_t nodes : layerNodes) {
+        layerOffsets.push_back(totalInts);
+        totalInts += nodes * STREE_NODE_KEYS;
+    }
+
+    // Pad so that keys() and therefore every node starts on a cache line.
+    const size_t padInts = CACHE_LINE_BYTES / sizeof(int);
+    storage.assign(totalInts + padInts, std::numeric_limits<int>::max());
+    uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+    keysOffset = ((CACHE_LINE_BYTES - address % CACHE_LINE_BYTES) % CACHE_LINE_BYTES) / sizeof(int);
+    int* base = storage.data() + keysOffset;
+
+    size_t layers = layerNodes.size();
+    std::copy(sorted.begin(), sorted.end(), base + layerOffsets[layers - 1]);
+
+    // subtreeMin[i] = smallest key under node i of the layer built last.
+    std::vector<int> subtreeMin(layerNodes[layers - 1]);
+    for (size_t i = 0; i < subtreeMin.size(); ++i) {
+        subtreeMin[i] = base[layerOffsets[layers - 1] + i * STREE_NODE_KEYS];
+    }
+    for (size_t h = layers - 1; h-- > 0;) {
+        std::vector<int> parentMin(layerNodes[h]);
+        for (size_t k = 0; k < layerNodes[h]; ++k) {
+            int* node = base + layerOffsets[h] + k * STREE_NODE_KEYS;
+            for (size_t j = 0; j < STREE_NODE_KEYS; ++j) {
+                size_t child = k * STREE_FANOUT + j + 1;
+                if (child < subtreeMin.size()) node[j] = subtreeMin[child];
+            }
+            parentMin[k] = subtreeMin[k * STREE_FANOUT];
+        }
+        subtreeMin.swap(parentMin);
+    }
+}
+
+size_t STreeIndex::descend(int target) const {
+    static const STreeDescendFn descendFn = selectSTreeDescend(); // Detected once, on first use.
+    // Clamped because the padding at the end of the last node may be passed.
+    return std::min(count, descendFn(keys(), layerOffsets.data(), layerOffsets.size(), target));
+}
+
+size_t STreeIndex::lowerBound(int target) const {
+    // Keys < target are keys <= target - 1; the INT_MAX padding is never counted.
+    if (count == 0 || target == std::numeric_limits<int>::min()) return 0;
+    return descend(target - 1);
+}
+
+size_t STreeIndex::upperBound(int target) const {
+    if (count == 0 || target == std::numeric_limits<int>::max()) return count;
+    return descend(target);
+}
+
+int STreeIndex::find(int target) const {
+    size_t position = lowerBound(target);
+    if (position == count || keys()[layerOffsets.back() + position] != target) return -1;
+    return static_cast<int>(position);
+}
+
+size_t STreeIndex::countRange(int low, int high) const {
+    if (low > high) return 0;
+    return upperBound(high) - lowerBound(low);
+}
+
+size_t STreeIndex::memoryBytes() const {
+    return storage.capacity() * sizeof(int) + layerOffsets.capacity() * sizeof(size_t);
+}
+
+/**
+ * @brief Times building and querying an STreeIndex against std::lower_bound and
+ * the Eytzinger layout, and reports the extra memory the tree needs.
+ */
+static void sTreeBenchmark() {
+    const size_t sizes[] = {10000, 1000000, 10000000, 100000000};
+    const size_t queries = 1000000;
+    std::mt19937 rng(17);
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(1);
+    std::cout << "\nBenchmark: " << queries << " random lookups, ns per query; build time and memory vs the raw array\n";
+    std::cout << "       size | build ms | overhead | std::lower_bound | Eytzinger | S-tree lowerBound | S-tree countRange\n";
+    for (size_t n : sizes) {
+        std::vector<int> sorted(n);
+        for (size_t i = 0; i < n; ++i) sorted[i] = static_cast<int>(2 * i);
+        std::vector<int> targets(queries);
+        for (int& t : targets) t = static_cast<int>(rng() % (2 * n));
+
+        auto buildStart = std::chrono::steady_clock::now();
+        STreeIndex tree(sorted);
+        double buildMs =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+        double overheadPercent = 100.0 * (static_cast<double>(tree.memoryBytes()) / (n * sizeof(int)) - 1.0);
+        EytzingerIndex eytzinger(sorted);
+
+        auto timeQueries = [&](auto search) {
+            auto start = std::chrono::steady_clock::now();
+            long long checksum = 0;
+            for (int t : targets) checksum += search(t);
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            return std::make_pair(ns / queries, checksum);
+        };
+        auto stl = timeQueries([&](int t) {
+            return static_cast<long long>(std::lower_bound(sorted.begin(), sorted.end(), t) - sorted.begin());
+        });
+        auto eytz = timeQueries([&](int t) { return static_cast<long long>(eytzinger.lowerBound(t)); });
+        auto sTree = timeQueries([&](int t) { return static_cast<long long>(tree.lowerBound(t)); });
+        auto range = timeQueries([&](int t) { return static_cast<long long>(tree.countRange(t, t + 1000)); });
+
+        bool ok = stl.second == eytz.second && stl.second == sTree.second;
+        std::cout << std::setw(11) << n << " | " << std::setw(8) << buildMs << " | " << std::setw(7)
+                  << overheadPercent << "% | " << std::setw(16) << stl.first << " | " << std::setw(9) << eytz.first
+                  << " | " << std::setw(17) << sTree.first << " | " << range.first << (ok ? "" : " (WRONG)") << "\n";
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+// --- Interpolation search and a learned index ---
+//
+// Binary search ignores the values: it always probes the middle. When the keys
+// are close to evenly spread (timestamps, sequential ids), the position of a
+// target can be estimated from its value instead:
+//   position ~ lo + (target - arr[lo]) / (arr[hi] - arr[lo]) * (hi - lo)
+// - interpolationSearch re-estimates on every step. That takes O(log log n)
+//   probes on uniform keys, but can degrade to O(n) on skewed ones, so a step
+//   that fails to halve the range is followed by a plain bisection step.
+// - LearnedIndex fits the estimate once, as a piecewise-linear model whose
+//   error is bounded by construction, and then searches only a small window.
+
+const size_t INTERPOLATION_MIN_RANGE = 16; // below this a linear scan is cheapest
+
+/**
+ * @brief First index in arr[0..n) whose value is >= target, found by
+ * interpolation with a bisection fallback (never worse than ~2 log2(n) probes).
+ */
+static size_t interpolationLowerBound(const int* arr, size_t n, int target) {
+    // The answer is always in [lo, hi]: arr[lo - 1] < target <= arr[hi].
+    size_t lo = 0, hi = n;
+    while (hi - lo > INTERPOLATION_MIN_RANGE) {
+        if (target <= arr[lo]) return lo;
+        if (target > arr[hi - 1]) return hi;
+
+        size_t before = hi - lo;
+        double fraction = (static_cast<double>(target) - arr[lo]) / (static_cast<double>(arr[hi - 1]) - arr[lo]);
+        size_t probe = lo + static_cast<size_t>(fraction * static_cast<double>(hi - 1 - lo));
+        if (arr[probe] < target) lo = probe + 1; else hi = probe;
+
+        // Safety net: the estimate was poor, so halve the range the usual way.
+        if (hi - lo > before / 2) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (arr[mid] < target) lo = mid + 1; else hi = mid;
+        }
+    }
+    while (lo < hi && arr[lo] < target) ++lo;
+    return lo;
+}
+
+/**
+ * @brief Performs an interpolation search on a sorted vector.
+ * @return The first index of the target if found, otherwise -1.
+ */
+int interpolationSearch(const std::vector<int>& arr, int target) {
+    size_t i = interpolationLowerBound(arr.data(), arr.size(), target);
+    return (i < arr.size() && arr[i] == target) ? static_cast<int>(i) : -1;
+}
+
+LearnedIndex::LearnedIndex(const std::vector<int>& sorted, size_t maxError)
+    : data(&sorted), maxError(maxError) {
+    // Greedy "shrinking cone": a segment starts at a key and keeps the range of
+    // slopes that predict every key added so far within maxError. When the next
+    // key's range does not overlap it any more, a new segment starts there.
+    // Only the first occurrence of each key is a model point.
+    const double error = static_cast<double>(maxError);
+    size_t i = 0;
+    while (i < sorted.size()) {
+        Segment segment{sorted[i], i, 0.0};
+        double slopeLow = 0.0;
+        double slopeHigh = std::numeric_limits<double>::infinity();
+        size_t next = std::upper_bound(sorted.begin() + i, sorted.end(), sorted[i]) - sorted.begin();
+        while (next < sorted.size()) {
+            double dx = static_cast<double>(sorted[next]) - segment.firstKey;
+            double dy = static_cast<double>(next - segment.firstPosition);
+            double low = (dy - error) / dx;
+            double high = (dy + error) / dx;
+            if (low > slopeHigh || high < slopeLow) break;
+            slopeLow = std::max(slopeLow, low);
+            slopeHigh = std::min(slopeHigh, high);
+            next = std::upper_bound(sorted.begin() + next, sorted.end(), sorted[next]) - sorted.begin();
+        }
+        segment.slope = slopeHigh == std::numeric_limits<double>::infinity() ? 0.0 : (slopeLow + slopeHigh) / 2;
+        segments.push_back(segment);
+        i = next;
+    }
+}
+
+size_t LearnedIndex::lowerBound(int target) const {
+    const std::vector<int>& arr = *data;
+    size_t n = arr.size();
+    // Last segment starting at or before target; none means target < arr[0].
+    auto it = std::upper_bound(segments.begin(), segments.end(), target,
+                               [](int t, const Segment& s) { return t < s.firstKey; });
+    if (it == segments.begin()) return 0;
+    const Segment& s = *(it - 1);
+
+    double predicted = static_cast<double>(s.firstPosition) +
+                       s.slope * (static_cast<double>(target) - s.firstKey);
+    size_t center = std::min(n, static_cast<size_t>(std::max(predicted, static_cast<double>(s.firstPosition))));
+    size_t lo = center > maxError ? center - maxError : 0;
+    size_t hi = std::min(n, center + maxError + 2);
+    size_t position = std::lower_bound(arr.begin() + lo, arr.begin() + hi, target) - arr.begin();
+
+    // The bound is guaranteed for keys in the data. A target between two keys
+    // can land just outside the window (e.g. after a long run of duplicates);
+    // then the answer is found in the rest of the array.
+    if (position == lo && lo > 0 && arr[lo - 1] >= target) {
+        return std::lower_bound(arr.begin(), arr.begin() + lo, target) - arr.begin();
+    }
+    if (position == hi && hi < n && arr[hi] < target) {
+        return std::lower_bound(arr.begin() + hi, arr.end(), target) - arr.begin();
+    }
+    return position;
+}
+
+int LearnedIndex::find(int target) const {
+    size_t position = lowerBound(target);
+    return (position < data->size() && (*data)[position] == target) ? static_cast<int>(position) : -1;
+}
+
+/**
+ * @brief Compares binary, interpolation and learned-index search on uniform,
+ * skewed and clustered key sets.
+ */
+static void interpolationBenchmark() {
+    const size_t n = 10000000;
+    const size_t queries = 1000000;
+    std::mt19937 rng(18);
+
+    struct KeySet {
+        const char* name;
+        std::vector<int> keys;
+    };
+    std::vector<KeySet> keySets(3);
+    keySets[0].name = "uniform";
+    keySets[1].name = "skewed";
+    keySets[2].name = "clustered";
+    std::uniform_int_distribution<int> anyInt(0, std::numeric_limits<int>::max());
+    std::lognormal_distribution<double> lognormal(0.0, 2.0);
+    for (size_t i = 0; i < n; ++i) {
+        keySets[0].keys.push_back(anyInt(rng));
+        keySets[1].keys.push_back(static_cast<int>(std::min(lognormal(rng) * 1e5, 2e9)));
+    }
+    // Clustered: 1000 dense runs of ids at random places in the key space.
+    for (size_t cluster = 0; cluster < 1000; ++cluster) {
+        int start = anyInt(rng) / 2;
+        for (size_t i = 0; i < n / 1000; ++i) keySets[2].keys.push_back(start + static_cast<int>(i * 3));
+    }
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(1);
+    std::cout << "\nBenchmark: " << n << " keys, " << queries << " lookups (half hits), ns per query\n";
+    std::cout << "keys      | binarySearch | std::lower_bound | interpolation | learned index | segments\n";
+    for (KeySet& set : keySets) {
+        std::vector<int>& keys = set.keys;
+        std::sort(keys.begin(), keys.end());
+        std::vector<int> targets(queries);
+        for (size_t q = 0; q < queries; ++q) {
+            int key = keys[rng() % n];
+            // A neighbour of a key is usually a miss; step down at INT_MAX instead of overflowing.
+            int neighbour = key == std::numeric_limits<int>::max() ? key - 1 : key + 1;
+            targets[q] = (q % 2 == 0) ? key : neighbour;
+        }
+        LearnedIndex learned(keys);
+
+        // Every variant returns "found?" so the checksums must agree.
+        auto timeQueries = [&](auto search) {
+            auto start = std::chrono::steady_clock::now();
+            long long hits = 0;
+            for (int t : targets) hits += search(t) != -1;
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            return std::make_pair(ns / queries, hits);
+        };
+        auto binary = timeQueries([&](int t) { return binarySearch(keys, t); });
+        auto stl = timeQueries([&](int t) { return std::binary_search(keys.begin(), keys.end(), t) ? 0 : -1; });
+        auto interpolation = timeQueries([&](int t) { return interpolationSearch(keys, t); });
+        auto model = timeQueries([&](int t) { return learned.find(t); });
+
+        bool ok = binary.second == stl.second && binary.second == interpolation.second && binary.second == model.second;
+        std::cout << std::left << std::setw(9) << set.name << std::right << " | " << std::setw(12) << binary.first
+                  << " | " << std::setw(16) << stl.first << " | " << std::setw(13) << interpolation.first << " | "
+                  << std::setw(13) << model.first << " | " << learned.segmentCount() << (ok ? "" : " (WRONG)") << "\n";
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+// --- Batched binary search (many lookups in lock-step) ---
+//
+// A single binary search is a chain of dependent loads: the next probe address
+// is only known when the current one has arrived from memory, so the CPU waits
+// ~100 ns per cache miss and does nothing else.
+// Searches for different targets are independent, though. Running a group of
+// them in lock-step - one step of every search, then the next step of every
+// search - keeps many loads in flight at once, and prefetching both possible
+// next probes of each search hides most of the remaining latency.
+// All searches over the same array take the same number of steps, because the
+// branchless form below only depends on the length, not on the data.
+
+const size_t BATCH_GROUP_SIZE = 32; // searches advanced together
+
+/**
+ * @brief Branchless lower bound for a group of targets over arr[0..n), n >= 1.
+ */
+static void lowerBoundGroup(const int* arr, size_t n, const int* targets, size_t groupSize, size_t* bounds) {
+    const int* base[BATCH_GROUP_SIZE];
+    for (size_t g = 0; g < groupSize; ++g) base[g] = arr;
+
+    size_t len = n;
+    while (len > 1) {
+        size_t half = len / 2;
+        size_t nextHalf = (len - half) / 2;
+        for (size_t g = 0; g < groupSize; ++g) {
+            base[g] += (base[g][half - 1] < targets[g]) ? half : 0; // compiles to cmov
+            // Next step probes base + nextHalf - 1 or base + half + nextHalf - 1.
+            if (nextHalf > 0) {
+                prefetchRead(base[g] + nextHalf - 1);
+                prefetchRead(base[g] + half + nextHalf - 1);
+            }
+        }
+        len -= half;
+    }
+    for (size_t g = 0; g < groupSize; ++g) {
+        bounds[g] = static_cast<size_t>(base[g] - arr) + (*base[g] < targets[g]);
+    }
+}
+
+/**
+ * @brief Looks up targets[0..count) in a sorted vector at once.
+ * results[i] is the first index of targets[i], or -1 if it is not present.
+ */
+void binarySearchBatch(const std::vector<int>& sorted, const int* targets, size_t count, int* results) {
+    size_t n = sorted.size();
+    if (n == 0) {
+        std::fill(results, results + count, -1);
+        return;
+    }
+
+    size_t bounds[BATCH_GROUP_SIZE];
+    for (size_t start = 0; start < count; start += BATCH_GROUP_SIZE) {
+        size_t groupSize = std::min(BATCH_GROUP_SIZE, count - start);
+        lowerBoundGroup(sorted.data(), n, targets + start, groupSize, bounds);
+        for (size_t g = 0; g < groupSize; ++g) {
+            size_t i = bounds[g];
+            results[start + g] = (i < n && sorted[i] == targets[start + g]) ? static_cast<int>(i) : -1;
+        }
+    }
+}
+
+/**
+ * @brief Times binarySearchBatch against calling binarySearch in a loop, for
+ * batch sizes from 1 to 4096 on an array that does not fit in cache.
+ */
+static void batchSearchBenchmark() {
+    const size_t n = 10000000;
+    const size_t totalQueries = 1 << 20;
+    const size_t batchSizes[] = {1, 4, 16, 64, 256, 1024, 4096};
+    std::mt19937 rng(15);
+
+    std::vector<int> sorted(n);
+    for (size_t i = 0; i < n; ++i) sorted[i] = static_cast<int>(2 * i); // even numbers only
+    std::vector<int> targets(totalQueries);
+    for (int& t : targets) t = static_cast<int>(rng() % (2 * n));
+
+    std::vector<int> expected(totalQueries);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < totalQueries; ++i) expected[i] = binarySearch(sorted, targets[i]);
+    double loopNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nBenchmark: " << totalQueries << " lookups in " << n << " ints, ns per query\n";
+    std::cout << "binarySearch loop: " << loopNs / totalQueries << "\n";
+    std::cout << "batch size | binarySearchBatch | speedup\n";
+    std::vector<int> results(totalQueries);
+    for (size_t batch : batchSizes) {
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < totalQueries; i += batch) {
+            binarySearchBatch(sorted, targets.data() + i, std::min(batch, totalQueries - i), results.data() + i);
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << std::setw(10) << batch << " | " << std::setw(17) << ns / totalQueries << " | "
+                  << loopNs / ns << "x" << (results == expected ? "" : " (WRONG)") << "\n";
+    }
+}
+
+// --- SIMD and multithreaded linear search (unsorted data) ---
+//
+// When the data is searched only a few times, sorting it first does not pay
+// off, and the scan itself has to get faster:
+// - the SIMD kernels (simd_searchEx.cpp) compare 8-16 ints per iteration,
+// - parallelLinearSearch splits huge arrays across threads. It still returns
+//   the first index: a thread stops as soon as another thread has found a
+//   match earlier in the array, because it can no longer find a better one.
+
+const size_t PARALLEL_SEARCH_MIN_SIZE = 1 << 16;  // below this one thread is faster
+const size_t PARALLEL_SEARCH_BLOCK = 1 << 14;     // ints scanned between cancellation checks
+
+int linearSearchSimd(const std::vector<int>& arr, int target) {
+    size_t i = simdFindFirst(arr.data(), arr.size(), target);
+    return i == arr.size() ? -1 : static_cast<int>(i);
+}
+
+size_t countOccurrences(const std::vector<int>& arr, int target) {
+    return simdCount(arr.data(), arr.size(), target);
+}
+
+std::vector<size_t> findAllOccurrences(const std::vector<int>& arr, int target) {
+    std::vector<size_t> positions;
+    simdFindAll(arr.data(), arr.size(), target, 0, positions);
+    return positions;
+}
+
+int parallelLinearSearch(const std::vector<int>& arr, int target, unsigned numThreads) {
+    size_t n = arr.size();
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (numThreads == 1 || n < PARALLEL_SEARCH_MIN_SIZE) {
+        return linearSearchSimd(arr, target);
+    }
+
+    // Lowest matching index found so far by any thread (n = none yet).
+    std::atomic<size_t> firstMatch(n);
+    size_t chunk = (n + numThreads - 1) / numThreads;
+
+    auto worker = [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; block += PARALLEL_SEARCH_BLOCK) {
+            if (firstMatch.load(std::memory_order_relaxed) < block) {
+                return; // Cancelled: an earlier match already exists.
+            }
+            size_t blockEnd = std::min(block + PARALLEL_SEARCH_BLOCK, end);
+            size_t i = block + simdFindFirst(arr.data() + block, blockEnd - block, target);
+            if (i < blockEnd) {
+                size_t current = firstMatch.load(std::memory_order_relaxed);
+                while (i < current && !firstMatch.compare_exchange_weak(current, i)) {}
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        threads.emplace_back(worker, begin, end);
+    }
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    size_t result = firstMatch.load();
+    return result == n ? -1 : static_cast<int>(result);
+}
+
+/**
+ * @brief Times the scalar, SIMD and threaded linear searches on a large unsorted array.
+ */
+static void linearSearchBenchmark() {
+    const size_t n = 50000000;
+    std::mt19937 rng(16);
+    std::vector<int> data(n);
+    for (int& x : data) x = static_cast<int>(rng() % 1000000000) + 1; // target -7 never occurs
+
+    struct Case {
+        const char* name;
+        size_t position; // where the target is planted (n = absent)
+    };
+    const Case cases[] = {{"at 10%", n / 10}, {"at 50%", n / 2}, {"at 90%", n / 10 * 9}, {"absent", n}};
+    const int target = -7;
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nBenchmark: " << n << " unsorted ints, kernel " << simdSearchIsa() << ", "
+              << std::max(1u, std::thread::hardware_concurrency()) << " hardware thread(s) (ms)\n";
+    std::cout << "target  | linearSearch | SIMD | parallel\n";
+    for (const Case& c : cases) {
+        if (c.position < n) data[c.position] = target;
+
+        auto start = std::chrono::steady_clock::now();
+        int scalar = linearSearch(data, target);
+        double scalarMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        int simd = linearSearchSimd(data, target);
+        double simdMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        int parallel = parallelLinearSearch(data, target);
+        double parallelMs = elapsedMs(start);
+
+        bool ok = scalar == simd && scalar == parallel;
+        std::cout << std::left << std::setw(7) << c.name << std::right << " | " << std::setw(12) << scalarMs << " | "
+                  << std::setw(4) << simdMs << " | " << parallelMs << (ok ? "" : " (WRONG)") << "\n";
+        if (c.position < n) data[c.position] = 1;
+    }
+
+    // Count/find-all over many matches.
+    for (size_t i = 0; i < n; i += 1000) data[i] = target;
+    auto start = std::chrono::steady_clock::now();
+    size_t scalarCount = static_cast<size_t>(std::count(data.begin(), data.end(), target));
+    double scalarMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    size_t simdCountResult = countOccurrences(data, target);
+    double simdMs = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    size_t found = findAllOccurrences(data, target).size();
+    double findAllMs = elapsedMs(start);
+    std::cout << "count " << scalarCount << " matches: std::count " << scalarMs << " ms, SIMD count " << simdMs
+              << " ms, SIMD find-all " << findAllMs << " ms"
+              << (simdCountResult == scalarCount && found == scalarCount ? "" : " (WRONG)") << "\n";
+}
+
 /**
  * @brief Prints the elements of a vector.
  */
@@ -66,7 +830,7 @@ void searching_algorithmsEx(void) {
     int target;
     int choice = 0;
 
-    while (choice != 3) {
+    while (choice != 9) {
         std::cout << "\n--- Search Menu ---\n";
         std::cout << "Unsorted Data: ";
         printVector(data);
@@ -79,22 +843,89 @@ void searching_algorithmsEx(void) {
 
         std::cout << "\n1. Linear Search (on unsorted data)\n";
         std::cout << "2. Binary Search (on sorted data)\n";
-        std::cout << "3. Back to main menu\n";
+        std::cout << "3. Eytzinger Search (lower/upper bound on sorted data)\n";
+        std::cout << "4. Benchmark: Eytzinger layout vs Binary Search\n";
+        std::cout << "5. Batched Binary Search (many targets at once)\n";
+        std::cout << "6. SIMD / Parallel Linear Search (count, find all)\n";
+        std::cout << "7. Static B-tree (S-tree): range count + benchmark\n";
+        std::cout << "8. Interpolation / Learned Index Search (on sorted data)\n";
+        std::cout << "9. Back to main menu\n";
         std::cout << "Enter your choice: ";
         std::cin >> choice;
 
-        if (std::cin.fail() || choice < 1 || choice > 3) {
-            std::cout << "\nInvalid input. Please enter a number between 1 and 3.\n";
+        if (std::cin.fail() || choice < 1 || choice > 9) {
+            std::cout << "\nInvalid input. Please enter a number between 1 and 9.\n";
             std::cin.clear();
             std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             continue;
         }
 
-        if (choice == 3) break;
+        if (choice == 9) break;
+        if (choice == 4) {
+            eytzingerBenchmark();
+            continue;
+        }
+        if (choice == 5) {
+            // Every value of the data plus its successor (a miss unless it is also present).
+            std::vector<int> targets;
+            for (int value : data) {
+                targets.push_back(value);
+                targets.push_back(value + 1);
+            }
+            std::vector<int> results(targets.size());
+            binarySearchBatch(sorted_data, targets.data(), targets.size(), results.data());
+            for (size_t i = 0; i < targets.size(); ++i) {
+                std::cout << "-> " << targets[i] << ": "
+                          << (results[i] != -1 ? "index " + std::to_string(results[i]) : "not found") << "\n";
+            }
+            batchSearchBenchmark();
+            continue;
+        }
+        if (choice == 7) {
+            int low, high;
+            std::cout << "Enter the range (low high): ";
+            std::cin >> low >> high;
+            STreeIndex tree(sorted_data);
+            std::cout << "-> lower_bound index of " << low << ": " << tree.lowerBound(low) << "\n";
+            std::cout << "-> " << tree.countRange(low, high) << " value(s) in [" << low << ", " << high << "]\n";
+            sTreeBenchmark();
+            continue;
+        }
 
         std::cout << "Enter the number to search for: ";
         std::cin >> target;
 
+        if (choice == 6) {
+            std::cout << "-> SIMD (" << simdSearchIsa() << ") first index: " << linearSearchSimd(data, target)
+                      << ", parallel first index: " << parallelLinearSearch(data, target) << "\n";
+            std::vector<size_t> positions = findAllOccurrences(data, target);
+            std::cout << "-> " << countOccurrences(data, target) << " occurrence(s) at:";
+            for (size_t position : positions) std::cout << " " << position;
+            std::cout << "\n";
+            linearSearchBenchmark();
+            continue;
+        }
+        if (choice == 8) {
+            LearnedIndex learned(sorted_data, 2);
+            std::cout << "-> interpolation search: " << interpolationSearch(sorted_data, target)
+                      << ", learned index (" << learned.segmentCount() << " segments): " << learned.find(target)
+                      << " (-1 = not found)\n";
+            interpolationBenchmark();
+            continue;
+        }
+        if (choice == 3) {
+            EytzingerIndex index(sorted_data);
+            std::cout << "-> lower_bound index: " << index.lowerBound(target)
+                      << ", upper_bound index: " << index.upperBound(target) << "\n";
+            int position = index.find(target);
+            if (position != -1) {
+                std::cout << "-> Found " << target << " at index " << position << ".\n";
+            } else {
+                std::cout << "-> " << target << " was not found.\n";
+            }
+            continue;
+        }
+
         int result = (choice == 1) ? linearSearch(data, target) : binarySearch(sorted_data, target);
 
         if (result != -1) {
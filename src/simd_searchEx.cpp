@@ -0,0 +1,187 @@
+#include "cpu_featuresEx.h"
+#include "simd_searchEx.h"
+
+// --- SIMD Linear Search ---
+//
+// One vector compare checks 8 (AVX2) or 4 (SSE4.1) ints against the target and
+// yields an all-ones lane for every match. movemask packs the lanes' top bits
+// into an ordinary int, so "is there a match?" is one test and "where is the
+// first one?" is a count-trailing-zeros of that int.
+// Two vectors are compared per iteration and OR-ed, so the common no-match
+// case costs a single branch per 16 (AVX2) or 8 (SSE4.1) ints.
+
+static size_t findFirstScalar(const int* data, size_t n, int target) {
+    for (size_t i = 0; i < n; ++i) {
+        if (data[i] == target) return i;
+    }
+    return n;
+}
+
+static size_t countScalar(const int* data, size_t n, int target) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i) {
+        count += (data[i] == target);
+    }
+    return count;
+}
+
+static void findAllScalar(const int* data, size_t n, int target, size_t offset, std::vector<size_t>& out) {
+    for (size_t i = 0; i < n; ++i) {
+        if (data[i] == target) out.push_back(offset + i);
+    }
+}
+
+#if SIMD_X86
+
+// Per-lane match counts are flushed to 64 bits this often, long before a
+// 32-bit lane could overflow.
+const size_t SIMD_COUNT_FLUSH_ITERATIONS = size_t(1) << 24;
+
+// ===================== AVX2: 8 ints per register =====================
+
+TARGET_AVX2 static inline unsigned matchMask8(const int* p, __m256i target) {
+    __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), target);
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+}
+
+TARGET_AVX2 static size_t findFirstAVX2(const int* data, size_t n, int target) {
+    __m256i t = _mm256_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), t);
+        __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)), t);
+        __m256i any = _mm256_or_si256(a, b);
+        if (!_mm256_testz_si256(any, any)) {
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(a))) |
+                            (static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(b))) << 8);
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+    size_t rest = findFirstScalar(data + i, n - i, target);
+    return i + rest;
+}
+
+TARGET_AVX2 static size_t countAVX2(const int* data, size_t n, int target) {
+    __m256i t = _mm256_set1_epi32(target);
+    size_t count = 0;
+    size_t i = 0;
+    while (i + 8 <= n) {
+        // A match lane is -1, so subtracting the compare result counts matches per lane.
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t iter = 0; iter < SIMD_COUNT_FLUSH_ITERATIONS && i + 8 <= n; ++iter, i += 8) {
+            __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), t);
+            acc = _mm256_sub_epi32(acc, eq);
+        }
+        alignas(32) unsigned lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (unsigned lane : lanes) count += lane;
+    }
+    return count + countScalar(data + i, n - i, target);
+}
+
+TARGET_AVX2 static void findAllAVX2(const int* data, size_t n, int target, size_t offset, std::vector<size_t>& out) {
+    __m256i t = _mm256_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        unsigned mask = matchMask8(data + i, t);
+        while (mask != 0) {
+            out.push_back(offset + i + static_cast<size_t>(__builtin_ctz(mask)));
+            mask &= mask - 1; // clear the lowest set bit
+        }
+    }
+    findAllScalar(data + i, n - i, target, offset + i, out);
+}
+
+// ===================== SSE4.1: 4 ints per register =====================
+
+TARGET_SSE41 static inline unsigned matchMask4(const int* p, __m128i target) {
+    __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), target);
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq)));
+}
+
+TARGET_SSE41 static size_t findFirstSSE41(const int* data, size_t n, int target) {
+    __m128i t = _mm_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), t);
+        __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4)), t);
+        __m128i any = _mm_or_si128(a, b);
+        if (!_mm_testz_si128(any, any)) {
+            unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(a))) |
+                            (static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(b))) << 4);
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+    size_t rest = findFirstScalar(data + i, n - i, target);
+    return i + rest;
+}
+
+TARGET_SSE41 static size_t countSSE41(const int* data, size_t n, int target) {
+    __m128i t = _mm_set1_epi32(target);
+    size_t count = 0;
+    size_t i = 0;
+    while (i + 4 <= n) {
+        __m128i acc = _mm_setzero_si128();
+        for (size_t iter = 0; iter < SIMD_COUNT_FLUSH_ITERATIONS && i + 4 <= n; ++iter, i += 4) {
+            __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), t);
+            acc = _mm_sub_epi32(acc, eq);
+        }
+        alignas(16) unsigned lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        for (unsigned lane : lanes) count += lane;
+    }
+    return count + countScalar(data + i, n - i, target);
+}
+
+TARGET_SSE41 static void findAllSSE41(const int* data, size_t n, int target, size_t offset, std::vector<size_t>& out) {
+    __m128i t = _mm_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        unsigned mask = matchMask4(data + i, t);
+        while (mask != 0) {
+            out.push_back(offset + i + static_cast<size_t>(__builtin_ctz(mask)));
+            mask &= mask - 1;
+        }
+    }
+    findAllScalar(data + i, n - i, target, offset + i, out);
+}
+
+#endif // SIMD_X86
+
+// --- Runtime dispatch ---
+
+struct SimdSearchImpl {
+    size_t (*findFirst)(const int*, size_t, int);
+    size_t (*count)(const int*, size_t, int);
+    void (*findAll)(const int*, size_t, int, size_t, std::vector<size_t>&);
+    const char* name;
+};
+
+static SimdSearchImpl selectSimdSearch() {
+#if SIMD_X86
+    if (cpuHasAVX2()) return {findFirstAVX2, countAVX2, findAllAVX2, "AVX2"};
+    if (cpuHasSSE41()) return {findFirstSSE41, countSSE41, findAllSSE41, "SSE4.1"};
+#endif
+    return {findFirstScalar, countScalar, findAllScalar, "scalar"};
+}
+
+static const SimdSearchImpl& simdSearchImpl() {
+    static const SimdSearchImpl impl = selectSimdSearch(); // Detected once, on first use.
+    return impl;
+}
+
+size_t simdFindFirst(const int* data, size_t n, int target) {
+    return simdSearchImpl().findFirst(data, n, target);
+}
+
+size_t simdCount(const int* data, size_t n, int target) {
+    return simdSearchImpl().count(data, n, target);
+}
+
+void simdFindAll(const int* data, size_t n, int target, size_t offset, std::vector<size_t>& out) {
+    simdSearchImpl().findAll(data, n, target, offset, out);
+}
+
+const char* simdSearchIsa(void) {
+    return simdSearchImpl().name;
+}
@@ -2,8 +2,23 @@
 #include <vector>
 #include <algorithm> // For std::swap
 #include <limits>    // For std::numeric_limits
+#include <cstddef>   // For std::ptrdiff_t
+#include <cstdint>   // For uint32_t
+#include <thread>    // For std::thread (parallel sample sort)
+#include <atomic>
+#include <random>    // For std::mt19937
+#include <chrono>    // For timing the demos
+#include <fstream>   // For external sort run files
+#include <memory>    // For std::unique_ptr
+#include <cstdio>    // For std::remove
+#include <cstring>   // For std::memcpy
+#include <iomanip>   // For std::setw (benchmark tables)
+#include <string_view> // For string sort keys
 #include "helloEx.h" // for printLine
 #include "sorting_algorithmsEx.h"
+#include "sorting_networksEx.h" // SIMD base case for introsort/pdqsort
+#include "generic_sortEx.h"     // Templates over any record type
+#include "sort_instrumentationEx.h"
 
 void printSortVector(const std::string& title, const std::vector<int>& arr) {
     std::cout << title;
@@ -14,6 +29,20 @@ void printSortVector(const std::string& title, const std::vector<int>& arr) {
 }
 
 // --- Sorting Algorithm Implementations ---
+//
+// quickSort, quickSortHoare, introSort and timSort are templates over an
+// instrumentation policy (sort_instrumentationEx.h). The public functions use
+// NoSortInstrumentation, whose hooks compile away; the *Counted variants in
+// section 16 count comparisons, moves and recursion depth.
+
+/**
+ * @brief a < b, reported to the instrumentation policy.
+ */
+template <typename Instr>
+static inline bool lessThan(int a, int b) {
+    Instr::compare();
+    return a < b;
+}
 
 // 1. Bubble Sort
 void bubbleSort(std::vector<int>& arr) {
@@ -50,49 +79,1961 @@ void selectionSort(std::vector<int>& arr) {
 }
 
 // 3. Quick Sort (Lomuto partition scheme)
+template <typename Instr = NoSortInstrumentation>
 int partition(std::vector<int>& arr, int low, int high) {
     int pivot = arr[high];
     int i = (low - 1);
 
     for (int j = low; j <= high - 1; j++) {
-        if (arr[j] < pivot) {
+        if (lessThan<Instr>(arr[j], pivot)) {
             i++;
             std::swap(arr[i], arr[j]);
+            Instr::swap();
         }
     }
     std::swap(arr[i + 1], arr[high]);
+    Instr::swap();
     return (i + 1);
 }
 
-
-void quickSort(std::vector<int>& arr, int low, int high) {
+template <typename Instr>
+static void quickSortLomuto(std::vector<int>& arr, int low, int high) {
+    SortDepthScope<Instr> depth;
     if (low < high) {
-        int pi = partition(arr, low, high);
-        quickSort(arr, low, pi - 1);
-        quickSort(arr, pi + 1, high);
+        int pi = partition<Instr>(arr, low, high);
+        quickSortLomuto<Instr>(arr, low, pi - 1);
+        quickSortLomuto<Instr>(arr, pi + 1, high);
     }
 }
 
+void quickSort(std::vector<int>& arr, int low, int high) {
+    quickSortLomuto<NoSortInstrumentation>(arr, low, high);
+}
+
 // 4. Quick Sort (Hoare partition scheme variant)
-void quickSortHoare(std::vector<int>& arr, int low, int high) {
+template <typename Instr>
+static void quickSortHoareLoop(std::vector<int>& arr, int low, int high) {
     if (low >= high) {
         return;
     }
+    SortDepthScope<Instr> depth;
 
     int i = low;
     int j = high;
     int pivot = arr[low]; // Using the first element as the pivot
 
     while (i < j) {
-        while (i < j && arr[j] >= pivot) { j--; }
-        while (i < j && arr[i] <= pivot) { i++; }
+        while (i < j && !lessThan<Instr>(arr[j], pivot)) { j--; }
+        while (i < j && !lessThan<Instr>(pivot, arr[i])) { i++; }
         if (i < j) {
             std::swap(arr[i], arr[j]);
+            Instr::swap();
         }
     }
     std::swap(arr[low], arr[i]); // Place pivot in its final sorted position
-    quickSortHoare(arr, low, i - 1);
-    quickSortHoare(arr, i + 1, high);
+    Instr::swap();
+    quickSortHoareLoop<Instr>(arr, low, i - 1);
+    quickSortHoareLoop<Instr>(arr, i + 1, high);
+}
+
+void quickSortHoare(std::vector<int>& arr, int low, int high) {
+    quickSortHoareLoop<NoSortInstrumentation>(arr, low, high);
+}
+
+// 5. Intro Sort (quicksort + heapsort fallback + sorting network cutoff)
+//
+// The plain quick sorts above pick a fixed pivot, so sorted or reversed input
+// makes them O(n^2) and recursion O(n) deep. Introsort fixes both problems:
+// - median-of-three (ninther for big ranges) pivots make bad splits unlikely,
+// - when the depth exceeds 2*log2(n) the range is finished with heapsort,
+// - it recurses only into the smaller half and loops on the larger one,
+//   so the stack never grows beyond O(log n).
+// Ranges of up to sortNetworkLimit() elements (64 with AVX2) are finished by
+// a branch-free SIMD sorting network (see sorting_networksEx.cpp).
+
+const std::ptrdiff_t INTRO_NINTHER_THRESHOLD = 128;   // big ranges -> median of medians
+const std::ptrdiff_t INTRO_COUNTED_CUTOFF = 16;       // insertion sort cutoff when counting
+
+/**
+ * @brief Sorts [first, last) with insertion sort. Fast for tiny ranges.
+ */
+template <typename Instr = NoSortInstrumentation>
+static void insertionSortRange(int* first, int* last) {
+    if (first == last) return;
+    for (int* i = first + 1; i < last; ++i) {
+        int value = *i;
+        int* j = i;
+        while (j > first && lessThan<Instr>(value, *(j - 1))) {
+            *j = *(j - 1);
+            --j;
+        }
+        *j = value;
+        Instr::move(static_cast<uint64_t>(i - j) + 2);
+    }
+}
+
+/**
+ * @brief Moves base[root] down the max-heap of size n until the heap property holds.
+ */
+template <typename Instr = NoSortInstrumentation>
+static void siftDown(int* base, std::ptrdiff_t n, std::ptrdiff_t root) {
+    int value = base[root];
+    Instr::move(2);
+    while (true) {
+        std::ptrdiff_t child = 2 * root + 1;
+        if (child >= n) break;
+        if (child + 1 < n && lessThan<Instr>(base[child], base[child + 1])) {
+            ++child;
+        }
+        if (!lessThan<Instr>(value, base[child])) break;
+        base[root] = base[child];
+        Instr::move();
+        root = child;
+    }
+    base[root] = value;
+}
+
+/**
+ * @brief Sorts [first, last) with heapsort. Used as the worst-case fallback.
+ */
+template <typename Instr = NoSortInstrumentation>
+static void heapSortRange(int* first, int* last) {
+    std::ptrdiff_t n = last - first;
+    for (std::ptrdiff_t i = n / 2 - 1; i >= 0; --i) {
+        siftDown<Instr>(first, n, i);
+    }
+    for (std::ptrdiff_t end = n - 1; end > 0; --end) {
+        std::swap(first[0], first[end]);
+        Instr::swap();
+        siftDown<Instr>(first, end, 0);
+    }
+}
+
+/**
+ * @brief Orders three elements so that *a <= *b <= *c.
+ */
+template <typename Instr = NoSortInstrumentation>
+static void sort3(int* a, int* b, int* c) {
+    if (lessThan<Instr>(*b, *a)) { std::swap(*a, *b); Instr::swap(); }
+    if (lessThan<Instr>(*c, *b)) { std::swap(*b, *c); Instr::swap(); }
+    if (lessThan<Instr>(*b, *a)) { std::swap(*a, *b); Instr::swap(); }
+}
+
+/**
+ * @brief Picks a pivot for [first, last) and moves it to *first.
+ * Uses median-of-three, or Tukey's ninther (median of three medians) for big ranges.
+ */
+template <typename Instr = NoSortInstrumentation>
+static void choosePivot(int* first, int* last) {
+    std::ptrdiff_t n = last - first;
+    int* mid = first + n / 2;
+    if (n > INTRO_NINTHER_THRESHOLD) {
+        sort3<Instr>(first, mid, last - 1);
+        sort3<Instr>(first + 1, mid - 1, last - 2);
+        sort3<Instr>(first + 2, mid + 1, last - 3);
+        sort3<Instr>(mid - 1, mid, mid + 1);
+    } else {
+        sort3<Instr>(first, mid, last - 1);
+    }
+    std::swap(*first, *mid);
+    Instr::swap();
+}
+
+/**
+ * @brief Hoare-style partition around the pivot stored in *first.
+ * Elements equal to the pivot stop both scans, so duplicates split evenly.
+ * @return Pointer to the pivot's final position.
+ */
+template <typename Instr = NoSortInstrumentation>
+static int* partitionAroundFirst(int* first, int* last) {
+    int pivot = *first;
+    int* i = first + 1;
+    int* j = last - 1;
+    while (true) {
+        while (i <= j && lessThan<Instr>(*i, pivot)) ++i;
+        while (lessThan<Instr>(pivot, *j)) --j; // *first == pivot stops this scan
+        if (i >= j) break;
+        std::swap(*i, *j);
+        Instr::swap();
+        ++i;
+        --j;
+    }
+    std::swap(*first, *j);
+    Instr::swap();
+    return j;
+}
+
+template <typename Instr>
+static void introSortLoop(int* first, int* last, int depthLimit, std::ptrdiff_t cutoff) {
+    SortDepthScope<Instr> depth;
+    while (last - first > cutoff) {
+        if (depthLimit == 0) {
+            heapSortRange<Instr>(first, last); // Too many bad splits: switch to O(n log n) heapsort
+            return;
+        }
+        --depthLimit;
+
+        choosePivot<Instr>(first, last);
+        int* p = partitionAroundFirst<Instr>(first, last);
+
+        // Recurse into the smaller half, loop on the larger one (tail-call elimination).
+        if (p - first < last - (p + 1)) {
+            introSortLoop<Instr>(first, p, depthLimit, cutoff);
+            first = p + 1;
+        } else {
+            introSortLoop<Instr>(p + 1, last, depthLimit, cutoff);
+            last = p;
+        }
+    }
+    if constexpr (Instr::enabled) {
+        insertionSortRange<Instr>(first, last); // The network has no single comparisons to count.
+    } else {
+        sortNetwork(first, last);
+    }
+}
+
+template <typename Instr>
+static void introSortVector(std::vector<int>& arr) {
+    if (arr.size() < 2) return;
+
+    int depthLimit = 0;
+    for (size_t n = arr.size(); n > 1; n >>= 1) {
+        depthLimit += 2; // 2 * floor(log2(n))
+    }
+    std::ptrdiff_t cutoff = static_cast<std::ptrdiff_t>(sortNetworkLimit());
+    if constexpr (Instr::enabled) {
+        cutoff = INTRO_COUNTED_CUTOFF;
+    }
+    introSortLoop<Instr>(arr.data(), arr.data() + arr.size(), depthLimit, cutoff);
+}
+
+/**
+ * @brief Sorts the whole vector with introsort.
+ * Guaranteed O(n log n) time and O(log n) stack, even on sorted/reversed input.
+ */
+void introSort(std::vector<int>& arr) {
+    introSortVector<NoSortInstrumentation>(arr);
+}
+
+// 6. Pattern-Defeating Quick Sort (pdqsort)
+//
+// The Lomuto 'partition' above branches on every 'arr[j] < pivot'. On random
+// data that branch is mispredicted about half the time. pdqsort (Orson Peters)
+// partitions in blocks instead: it first records the offsets of misplaced
+// elements into small buffers without branching ('num += !(x < pivot)') and
+// then swaps them in bulk. It also
+// - detects ranges that were already partitioned and finishes them with a
+//   bounded insertion sort (linear time on sorted/nearly-sorted input),
+// - groups elements equal to the pivot so duplicate-heavy input stays fast,
+// - shuffles a few elements after a very unbalanced split to break
+//   adversarial patterns, and falls back to heapsort if that keeps happening.
+
+const std::ptrdiff_t PDQ_INSERTION_THRESHOLD = 24;
+const std::ptrdiff_t PDQ_NINTHER_THRESHOLD = 128;
+const std::ptrdiff_t PDQ_PARTIAL_INSERTION_LIMIT = 8;
+const size_t PDQ_BLOCK_SIZE = 64; // offsets must fit in an unsigned char
+
+/**
+ * @brief Insertion sort that assumes *(first - 1) is <= every element in the range,
+ * so the inner loop needs no bounds check.
+ */
+static void unguardedInsertionSortRange(int* first, int* last) {
+    if (first == last) return;
+    for (int* i = first + 1; i < last; ++i) {
+        int value = *i;
+        int* j = i;
+        while (*(j - 1) > value) {
+            *j = *(j - 1);
+            --j;
+        }
+        *j = value;
+    }
+}
+
+/**
+ * @brief Insertion sort that gives up after moving PDQ_PARTIAL_INSERTION_LIMIT elements.
+ * @return true if the range is now sorted.
+ */
+static bool partialInsertionSortRange(int* first, int* last) {
+    if (first == last) return true;
+    std::ptrdiff_t moved = 0;
+    for (int* i = first + 1; i < last; ++i) {
+        if (*i < *(i - 1)) {
+            int value = *i;
+            int* j = i;
+            do {
+                *j = *(j - 1);
+                --j;
+            } while (j > first && *(j - 1) > value);
+            *j = value;
+            moved += i - j;
+        }
+        if (moved > PDQ_PARTIAL_INSERTION_LIMIT) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Swaps 'num' misplaced pairs found by the block partition.
+ * Uses a cyclic permutation (fewer moves) unless both blocks are full,
+ * where plain swaps keep descending input linear.
+ */
+static void swapOffsets(int* leftBase, int* rightBase,
+                        const unsigned char* offsetsL, const unsigned char* offsetsR,
+                        size_t num, bool useSwaps) {
+    if (useSwaps) {
+        for (size_t i = 0; i < num; ++i) {
+            std::swap(leftBase[offsetsL[i]], *(rightBase - offsetsR[i]));
+        }
+    } else if (num > 0) {
+        int* l = leftBase + offsetsL[0];
+        int* r = rightBase - offsetsR[0];
+        int tmp = *l;
+        *l = *r;
+        for (size_t i = 1; i < num; ++i) {
+            l = leftBase + offsetsL[i];
+            *r = *l;
+            r = rightBase - offsetsR[i];
+            *l = *r;
+        }
+        *r = tmp;
+    }
+}
+
+/**
+ * @brief Branchless block partition around the pivot stored in *first.
+ * Elements < pivot go left, elements >= pivot go right.
+ * @param alreadyPartitioned Set to true if no element had to be moved.
+ * @return Pointer to the pivot's final position.
+ */
+static int* pdqPartitionRight(int* begin, int* end, bool& alreadyPartitioned) {
+    int pivot = *begin;
+    int* first = begin;
+    int* last = end;
+
+    // Find the first element >= pivot (the median-of-three guarantees one exists).
+    while (*++first < pivot) {}
+
+    // Find the first element < pivot from the right. Guard the scan only if
+    // nothing before 'first' can act as a sentinel.
+    if (first - 1 == begin) {
+        while (first < last && !(*--last < pivot)) {}
+    } else {
+        while (!(*--last < pivot)) {}
+    }
+
+    alreadyPartitioned = first >= last;
+    if (!alreadyPartitioned) {
+        std::swap(*first, *last);
+        ++first;
+
+        unsigned char offsetsL[PDQ_BLOCK_SIZE];
+        unsigned char offsetsR[PDQ_BLOCK_SIZE];
+        int* leftBase = first;
+        int* rightBase = last;
+        size_t numL = 0, numR = 0, startL = 0, startR = 0;
+
+        while (first < last) {
+            // Decide how many unknown elements each side scans in this round.
+            size_t numUnknown = static_cast<size_t>(last - first);
+            size_t leftSplit = numL == 0 ? (numR == 0 ? numUnknown / 2 : numUnknown) : 0;
+            size_t rightSplit = numR == 0 ? (numUnknown - leftSplit) : 0;
+            if (leftSplit > PDQ_BLOCK_SIZE) leftSplit = PDQ_BLOCK_SIZE;
+            if (rightSplit > PDQ_BLOCK_SIZE) rightSplit = PDQ_BLOCK_SIZE;
+
+            // Record offsets of misplaced elements. No branch on the comparison:
+            // the offset is always written, the count only advances on a hit.
+            for (size_t i = 0; i < leftSplit; ++i) {
+                offsetsL[numL] = static_cast<unsigned char>(i);
+                numL += !(*first < pivot);
+                ++first;
+            }
+            for (size_t i = 0; i < rightSplit;) {
+                offsetsR[numR] = static_cast<unsigned char>(++i);
+                numR += (*--last < pivot);
+            }
+
+            // Swap as many misplaced pairs as both blocks allow.
+            size_t num = std::min(numL, numR);
+            swapOffsets(leftBase, rightBase, offsetsL + startL, offsetsR + startR, num, numL == numR);
+            numL -= num;
+            numR -= num;
+            startL += num;
+            startR += num;
+            if (numL == 0) {
+                startL = 0;
+                leftBase = first;
+            }
+            if (numR == 0) {
+                startR = 0;
+                rightBase = last;
+            }
+        }
+
+        // One block may still hold misplaced elements; move them next to the boundary.
+        if (numL) {
+            while (numL--) {
+                std::swap(leftBase[offsetsL[startL + numL]], *--last);
+            }
+            first = last;
+        }
+        if (numR) {
+            while (numR--) {
+                std::swap(*(rightBase - offsetsR[startR + numR]), *first);
+                ++first;
+            }
+        }
+    }
+
+    int* pivotPos = first - 1;
+    *begin = *pivotPos;
+    *pivotPos = pivot;
+    return pivotPos;
+}
+
+/**
+ * @brief Partitions so that elements <= pivot go left. Used when the pivot equals
+ * the element just before the range, i.e. the range holds many equal keys.
+ * @return Pointer to the last element equal to the pivot.
+ */
+static int* pdqPartitionLeft(int* begin, int* end) {
+    int pivot = *begin;
+    int* first = begin;
+    int* last = end;
+
+    while (pivot < *--last) {}
+    if (last + 1 == end) {
+        while (first < last && !(pivot < *++first)) {}
+    } else {
+        while (!(pivot < *++first)) {}
+    }
+
+    while (first < last) {
+        std::swap(*first, *last);
+        while (pivot < *--last) {}
+        while (!(pivot < *++first)) {}
+    }
+
+    int* pivotPos = last;
+    *begin = *pivotPos;
+    *pivotPos = pivot;
+    return pivotPos;
+}
+
+static void pdqSortLoop(int* begin, int* end, int badAllowed, bool leftmost, std::ptrdiff_t networkLimit) {
+    while (true) {
+        std::ptrdiff_t size = end - begin;
+
+        if (size <= networkLimit) {
+            sortNetwork(begin, end);
+            return;
+        }
+        if (size < PDQ_INSERTION_THRESHOLD) {
+            if (leftmost) {
+                insertionSortRange(begin, end);
+            } else {
+                unguardedInsertionSortRange(begin, end);
+            }
+            return;
+        }
+
+        // Move the pivot (median-of-three or ninther) to *begin.
+        std::ptrdiff_t half = size / 2;
+        if (size > PDQ_NINTHER_THRESHOLD) {
+            sort3(begin, begin + half, end - 1);
+            sort3(begin + 1, begin + (half - 1), end - 2);
+            sort3(begin + 2, begin + (half + 1), end - 3);
+            sort3(begin + (half - 1), begin + half, begin + (half + 1));
+            std::swap(*begin, *(begin + half));
+        } else {
+            sort3(begin + half, begin, end - 1);
+        }
+
+        // If the element before this range equals the pivot, every element here is
+        // >= pivot. Put the equal ones on the left and skip them entirely.
+        if (!leftmost && !(*(begin - 1) < *begin)) {
+            begin = pdqPartitionLeft(begin, end) + 1;
+            continue;
+        }
+
+        bool alreadyPartitioned = false;
+        int* pivotPos = pdqPartitionRight(begin, end, alreadyPartitioned);
+
+        std::ptrdiff_t leftSize = pivotPos - begin;
+        std::ptrdiff_t rightSize = end - (pivotPos + 1);
+        bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+        if (highlyUnbalanced) {
+            // Too many bad splits: give up on quicksort for this range.
+            if (--badAllowed == 0) {
+                heapSortRange(begin, end);
+                return;
+            }
+
+            // Swap a few elements around to break the pattern that caused the bad split.
+            if (leftSize >= PDQ_INSERTION_THRESHOLD) {
+                std::swap(*begin, *(begin + leftSize / 4));
+                std::swap(*(pivotPos - 1), *(pivotPos - leftSize / 4));
+                if (leftSize > PDQ_NINTHER_THRESHOLD) {
+                    std::swap(*(begin + 1), *(begin + (leftSize / 4 + 1)));
+                    std::swap(*(begin + 2), *(begin + (leftSize / 4 + 2)));
+                    std::swap(*(pivotPos - 2), *(pivotPos - (leftSize / 4 + 1)));
+                    std::swap(*(pivotPos - 3), *(pivotPos - (leftSize / 4 + 2)));
+                }
+            }
+            if (rightSize >= PDQ_INSERTION_THRESHOLD) {
+                std::swap(*(pivotPos + 1), *(pivotPos + (1 + rightSize / 4)));
+                std::swap(*(end - 1), *(end - rightSize / 4));
+                if (rightSize > PDQ_NINTHER_THRESHOLD) {
+                    std::swap(*(pivotPos + 2), *(pivotPos + (2 + rightSize / 4)));
+                    std::swap(*(pivotPos + 3), *(pivotPos + (3 + rightSize / 4)));
+                    std::swap(*(end - 2), *(end - (1 + rightSize / 4)));
+                    std::swap(*(end - 3), *(end - (2 + rightSize / 4)));
+                }
+            }
+        } else if (alreadyPartitioned &&
+                   partialInsertionSortRange(begin, pivotPos) &&
+                   partialInsertionSortRange(pivotPos + 1, end)) {
+            // The split was balanced and nothing moved: the input was (nearly) sorted.
+            return;
+        }
+
+        // Sort the left part recursively and the right part in this loop.
+        pdqSortLoop(begin, pivotPos, badAllowed, leftmost, networkLimit);
+        begin = pivotPos + 1;
+        leftmost = false;
+    }
+}
+
+/**
+ * @brief Sorts [first, last) with pattern-defeating quicksort.
+ */
+static void pdqSortRange(int* first, int* last) {
+    int badAllowed = 0;
+    for (std::ptrdiff_t n = last - first; n > 1; n >>= 1) {
+        badAllowed++; // floor(log2(n))
+    }
+    pdqSortLoop(first, last, badAllowed, true, static_cast<std::ptrdiff_t>(sortNetworkLimit()));
+}
+
+/**
+ * @brief Sorts arr[low..high] (inclusive) with pattern-defeating quicksort.
+ * Same signature as quickSort/quickSortHoare so they can be swapped for A/B tests.
+ */
+void pdqSort(std::vector<int>& arr, int low, int high) {
+    if (low >= high) return;
+    pdqSortRange(arr.data() + low, arr.data() + high + 1);
+}
+
+// 7. LSD Radix Sort (for 32-bit ints)
+//
+// Comparison sorts need O(n log n) comparisons. For plain int keys we can do
+// better: sort by one byte at a time, least significant byte first, using a
+// stable counting scatter. Four passes over the data, no comparisons at all.
+// - Signed ints: flipping the sign bit maps INT_MIN..INT_MAX onto 0..UINT_MAX
+//   in the same order, so the top byte sorts negatives first.
+// - All four byte histograms are built in a single read of the input.
+// - A pass whose byte is the same for every element is skipped (e.g. the top
+//   bytes of small non-negative values).
+// - One scratch buffer is reused, ping-ponging between it and the input.
+
+const int RADIX_BITS = 8;
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+const int RADIX_PASSES = 32 / RADIX_BITS;
+const size_t RADIX_MIN_SIZE = 64; // below this insertion sort is faster
+
+/**
+ * @brief Maps an int to an unsigned key with the same ordering.
+ */
+static inline uint32_t radixKey(int value) {
+    return static_cast<uint32_t>(value) ^ 0x80000000u;
+}
+
+/**
+ * @brief Sorts the whole vector with an 8-bit-digit LSD radix sort.
+ * O(n) time, O(n) extra memory for one scratch buffer.
+ */
+void radixSort(std::vector<int>& arr) {
+    size_t n = arr.size();
+    if (n < RADIX_MIN_SIZE) {
+        insertionSortRange(arr.data(), arr.data() + n);
+        return;
+    }
+
+    // 1. Build the histograms of all four digits in one pass.
+    std::vector<size_t> counts(RADIX_PASSES * RADIX_BUCKETS, 0);
+    size_t* hist[RADIX_PASSES];
+    for (int pass = 0; pass < RADIX_PASSES; ++pass) {
+        hist[pass] = counts.data() + pass * RADIX_BUCKETS;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t key = radixKey(arr[i]);
+        hist[0][key & 0xFF]++;
+        hist[1][(key >> 8) & 0xFF]++;
+        hist[2][(key >> 16) & 0xFF]++;
+        hist[3][key >> 24]++;
+    }
+
+    std::vector<int> scratch(n);
+    int* src = arr.data();
+    int* dst = scratch.data();
+
+    for (int pass = 0; pass < RADIX_PASSES; ++pass) {
+        size_t* h = hist[pass];
+        int shift = pass * RADIX_BITS;
+
+        // 2. Skip the pass if every element has the same digit here.
+        if (h[(radixKey(src[0]) >> shift) & 0xFF] == n) {
+            continue;
+        }
+
+        // 3. Turn counts into starting offsets (exclusive prefix sum).
+        size_t sum = 0;
+        for (int b = 0; b < RADIX_BUCKETS; ++b) {
+            size_t count = h[b];
+            h[b] = sum;
+            sum += count;
+        }
+
+        // 4. Stable scatter into the other buffer.
+        for (size_t i = 0; i < n; ++i) {
+            int value = src[i];
+            dst[h[(radixKey(value) >> shift) & 0xFF]++] = value;
+        }
+        std::swap(src, dst);
+    }
+
+    // After an odd number of passes the result sits in the scratch buffer.
+    if (src != arr.data()) {
+        std::copy(src, src + n, arr.data());
+    }
+}
+
+// 8. Parallel Sample Sort (multi-core, std::thread)
+//
+// Every sort above runs on one core. Sample sort splits the work so that each
+// thread can sort its own piece independently:
+// 1. Draw an oversampled random sample, sort it, and keep every k-th element
+//    as a splitter. Oversampling makes the buckets nearly equal in size.
+// 2. Each thread classifies its chunk of the input into buckets and counts
+//    them in a private histogram (no locks, no shared counters).
+// 3. Prefix sums over all histograms give every (thread, bucket) pair its own
+//    output range, so all threads scatter in parallel without conflicts.
+// 4. Buckets are sorted independently with pdqsort, biggest first.
+// Keys equal to a splitter get their own "equality bucket" which needs no
+// sorting, so duplicate-heavy input does not pile up in one bucket.
+// Ints carry no identity besides their value, so the result is bit-identical
+// to std::sort.
+
+const size_t SAMPLE_SORT_MIN_SIZE = 1 << 17;   // below this the sequential path wins
+const size_t SAMPLE_SORT_MIN_PER_THREAD = 1 << 15;
+const size_t SAMPLE_SORT_OVERSAMPLING = 32;    // sample elements per splitter
+const size_t SAMPLE_SORT_BUCKETS_PER_THREAD = 4;
+const unsigned SAMPLE_SORT_MAX_THREADS = 1024;  // keeps bucket ids within uint16_t
+
+/**
+ * @brief Branchless lower_bound over the splitters.
+ * @return The number of splitters strictly less than 'key'.
+ */
+static inline size_t countSplittersBelow(const int* splitters, size_t count, int key) {
+    const int* base = splitters;
+    size_t n = count;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half] < key) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - splitters) + (*base < key);
+}
+
+/**
+ * @brief Runs fn(t) on 'numThreads' threads (t = 0..numThreads-1) and waits for all.
+ */
+template <typename Fn>
+static void runOnThreads(unsigned numThreads, Fn fn) {
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < numThreads; ++t) {
+        workers.emplace_back(fn, t);
+    }
+    fn(0u); // The calling thread does its share too.
+    for (auto& w : workers) {
+        w.join();
+    }
+}
+
+/**
+ * @brief Sorts the whole vector using 'numThreads' threads (0 = all hardware threads).
+ * Falls back to sequential pdqsort for small inputs or a single thread.
+ */
+void parallelSampleSort(std::vector<int>& arr, unsigned numThreads) {
+    size_t n = arr.size();
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min(numThreads, SAMPLE_SORT_MAX_THREADS);
+    numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, n / SAMPLE_SORT_MIN_PER_THREAD));
+    if (n < SAMPLE_SORT_MIN_SIZE || numThreads <= 1) {
+        if (n > 1) pdqSortRange(arr.data(), arr.data() + n);
+        return;
+    }
+
+    // 1. Pick splitters from an oversampled random sample (fixed seed: reproducible).
+    size_t numSplitters = numThreads * SAMPLE_SORT_BUCKETS_PER_THREAD - 1;
+    std::vector<int> sample((numSplitters + 1) * SAMPLE_SORT_OVERSAMPLING);
+    std::mt19937_64 rng(0x5EED);
+    for (int& s : sample) {
+        s = arr[rng() % n];
+    }
+    pdqSortRange(sample.data(), sample.data() + sample.size());
+
+    std::vector<int> splitters;
+    for (size_t i = 1; i <= numSplitters; ++i) {
+        int s = sample[i * SAMPLE_SORT_OVERSAMPLING];
+        if (splitters.empty() || splitters.back() != s) {
+            splitters.push_back(s); // Duplicates would only create empty buckets.
+        }
+    }
+    size_t m = splitters.size();
+    // Bucket 2i holds keys between splitters i-1 and i, bucket 2i+1 holds keys == splitter i.
+    size_t numBuckets = 2 * m + 1;
+
+    // 2. Classify every element and count per-thread histograms.
+    std::vector<uint16_t> bucketOf(n);
+    std::vector<size_t> hist(numThreads * numBuckets, 0);
+    size_t chunk = (n + numThreads - 1) / numThreads;
+
+    runOnThreads(numThreads, [&](unsigned t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        size_t* h = hist.data() + t * numBuckets;
+        for (size_t i = begin; i < end; ++i) {
+            int key = arr[i];
+            size_t j = countSplittersBelow(splitters.data(), m, key);
+            size_t b = 2 * j + (j < m && splitters[j] == key);
+            bucketOf[i] = static_cast<uint16_t>(b);
+            h[b]++;
+        }
+    });
+
+    // 3. Exclusive prefix sum in (bucket, thread) order: each thread gets its own
+    //    slice of every bucket.
+    std::vector<size_t> bucketStart(numBuckets + 1, 0);
+    size_t offset = 0;
+    for (size_t b = 0; b < numBuckets; ++b) {
+        bucketStart[b] = offset;
+        for (unsigned t = 0; t < numThreads; ++t) {
+            size_t count = hist[t * numBuckets + b];
+            hist[t * numBuckets + b] = offset;
+            offset += count;
+        }
+    }
+    bucketStart[numBuckets] = n;
+
+    std::vector<int> scratch(n);
+    runOnThreads(numThreads, [&](unsigned t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        size_t* pos = hist.data() + t * numBuckets;
+        for (size_t i = begin; i < end; ++i) {
+            scratch[pos[bucketOf[i]]++] = arr[i];
+        }
+    });
+
+    // 4. Sort the buckets in parallel, largest first for better load balance,
+    //    and copy each one back as soon as it is done.
+    std::vector<size_t> order(numBuckets);
+    for (size_t b = 0; b < numBuckets; ++b) order[b] = b;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+    });
+
+    std::atomic<size_t> next(0);
+    runOnThreads(numThreads, [&](unsigned) {
+        size_t k;
+        while ((k = next.fetch_add(1)) < numBuckets) {
+            size_t b = order[k];
+            int* first = scratch.data() + bucketStart[b];
+            int* last = scratch.data() + bucketStart[b + 1];
+            if (b % 2 == 0 && last - first > 1) {
+                pdqSortRange(first, last); // Equality buckets (odd b) are already sorted.
+            }
+            std::copy(first, last, arr.data() + bucketStart[b]);
+        }
+    });
+}
+
+/**
+ * @brief Times parallelSampleSort against std::sort on a larger random input.
+ */
+static void parallelSampleSortDemo() {
+    const size_t n = 4000000;
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::mt19937 rng(42);
+    std::vector<int> input(n);
+    for (int& x : input) x = static_cast<int>(rng());
+
+    std::vector<int> expected = input;
+    auto start = std::chrono::steady_clock::now();
+    std::sort(expected.begin(), expected.end());
+    double stdMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "\nstd::sort on " << n << " random ints: " << stdMs << " ms\n";
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        std::vector<int> work = input;
+        start = std::chrono::steady_clock::now();
+        parallelSampleSort(work, threads);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Sample sort, " << threads << " thread(s): " << ms << " ms"
+                  << (work == expected ? " (matches std::sort)" : " (MISMATCH!)") << "\n";
+    }
+}
+
+// 9. External Merge Sort (binary int32 files larger than RAM)
+//
+// When the data does not fit in memory we sort it in two phases:
+// 1. Run formation: read a chunk that fits the memory budget, sort it with
+//    radixSort, and write it to a temporary "run" file.
+// 2. Merge: read all runs through large sequential buffers and k-way merge
+//    them with a loser tree (one comparison per tree level per element).
+//    If there are more runs than buffers fit in the budget, runs are merged
+//    in groups over several passes.
+// Every read and write is a big sequential block, which is what disks like.
+
+static_assert(sizeof(int) == 4, "external sort files store 32-bit ints");
+
+const size_t EXTERNAL_SORT_MIN_BUFFER_BYTES = 64 * 1024; // smallest useful merge buffer
+// Two input buffers and one output buffer: the least a merge can work with.
+const size_t EXTERNAL_SORT_MIN_BUDGET_BYTES = 3 * EXTERNAL_SORT_MIN_BUFFER_BYTES;
+
+/**
+ * @brief Buffered sequential reader over one sorted run file.
+ */
+class RunReader {
+public:
+    RunReader(const std::string& path, size_t bufferElements, ExternalSortStats& stats)
+        : in(path, std::ios::binary), opened(in.is_open()), buffer(bufferElements), pos(0), len(0), stats(stats) {
+        refill();
+    }
+
+    bool isOpen() const { return opened; }
+    bool failed() const { return in.bad(); } // a read error, as opposed to the end of the run
+    bool exhausted() const { return pos >= len; }
+    int current() const { return buffer[pos]; }
+
+    void advance() {
+        if (++pos >= len) {
+            refill();
+        }
+    }
+
+private:
+    void refill() {
+        pos = 0;
+        len = 0;
+        if (!in) return;
+        in.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(int));
+        std::streamsize got = in.gcount();
+        len = static_cast<size_t>(got) / sizeof(int);
+        stats.bytesRead += static_cast<uint64_t>(got);
+    }
+
+    std::ifstream in;
+    bool opened;
+    std::vector<int> buffer;
+    size_t pos;
+    size_t len;
+    ExternalSortStats& stats;
+};
+
+/**
+ * @brief Buffered sequential writer. Flushes in large blocks.
+ */
+class RunWriter {
+public:
+    RunWriter(const std::string& path, size_t bufferElements, ExternalSortStats& stats)
+        : out(path, std::ios::binary | std::ios::trunc), stats(stats) {
+        buffer.reserve(bufferElements);
+    }
+
+    ~RunWriter() { flush(); }
+
+    bool good() const { return static_cast<bool>(out); }
+
+    void push(int value) {
+        buffer.push_back(value);
+        if (buffer.size() == buffer.capacity()) {
+            flush();
+        }
+    }
+
+    void write(const int* data, size_t count) {
+        flush();
+        out.write(reinterpret_cast<const char*>(data), count * sizeof(int));
+        stats.bytesWritten += count * sizeof(int);
+    }
+
+    void flush() {
+        if (buffer.empty()) return;
+        out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(int));
+        stats.bytesWritten += buffer.size() * sizeof(int);
+        buffer.clear();
+    }
+
+private:
+    std::ofstream out;
+    std::vector<int> buffer;
+    ExternalSortStats& stats;
+};
+
+/**
+ * @brief Tournament tree of losers for k-way merging.
+ * tree[0] holds the index of the overall winner (smallest current value);
+ * every internal node holds the loser of the match played there. After the
+ * winner advances, only its path to the root is replayed: log2(k) comparisons.
+ */
+class LoserTree {
+public:
+    explicit LoserTree(std::vector<std::unique_ptr<RunReader>>& runs)
+        : runs(runs), k(runs.size()), tree(std::max<size_t>(k, 1)) {
+        tree[0] = k > 0 ? build(1) : 0;
+    }
+
+    bool empty() const { return k == 0 || runs[tree[0]]->exhausted(); }
+    int top() const { return runs[tree[0]]->current(); }
+
+    void pop() {
+        size_t winner = tree[0];
+        runs[winner]->advance();
+        for (size_t node = (winner + k) / 2; node >= 1; node /= 2) {
+            if (beats(tree[node], winner)) {
+                std::swap(tree[node], winner);
+            }
+        }
+        tree[0] = winner;
+    }
+
+private:
+    // Exhausted runs act as +infinity.
+    bool beats(size_t a, size_t b) const {
+        if (runs[a]->exhausted()) return false;
+        if (runs[b]->exhausted()) return true;
+        return runs[a]->current() < runs[b]->current();
+    }
+
+    // Leaves are nodes k..2k-1; returns the winner of the subtree rooted at 'node'.
+    size_t build(size_t node) {
+        if (node >= k) return node - k;
+        size_t left = build(2 * node);
+        size_t right = build(2 * node + 1);
+        if (beats(right, left)) std::swap(left, right);
+        tree[node] = right; // loser stays here
+        return left;        // winner moves up
+    }
+
+    std::vector<std::unique_ptr<RunReader>>& runs;
+    size_t k;
+    std::vector<size_t> tree;
+};
+
+/**
+ * @brief Merges the given sorted run files into 'outputPath'.
+ */
+static bool mergeRuns(const std::vector<std::string>& runPaths, const std::string& outputPath,
+                      size_t memoryBudgetBytes, ExternalSortStats& stats) {
+    // Split the budget between one input buffer per run and one output buffer.
+    size_t bufferElements = memoryBudgetBytes / (runPaths.size() + 1) / sizeof(int);
+    // An empty buffer would read nothing and make every run look finished.
+    if (bufferElements * sizeof(int) < EXTERNAL_SORT_MIN_BUFFER_BYTES) {
+        std::cerr << "Error: merge buffers of " << bufferElements * sizeof(int) << " bytes for "
+                  << runPaths.size() << " runs are below the minimum" << std::endl;
+        return false;
+    }
+
+    std::vector<std::unique_ptr<RunReader>> readers;
+    for (const auto& path : runPaths) {
+        readers.push_back(std::make_unique<RunReader>(path, bufferElements, stats));
+        if (!readers.back()->isOpen()) {
+            std::cerr << "Error opening run file for reading: " << path << std::endl;
+            return false;
+        }
+    }
+
+    RunWriter writer(outputPath, bufferElements, stats);
+    if (!writer.good()) {
+        std::cerr << "Error opening file for writing: " << outputPath << std::endl;
+        return false;
+    }
+
+    LoserTree tree(readers);
+    while (!tree.empty()) {
+        writer.push(tree.top());
+        tree.pop();
+    }
+    for (size_t i = 0; i < readers.size(); ++i) {
+        if (readers[i]->failed()) {
+            std::cerr << "Error reading run file: " << runPaths[i] << std::endl;
+            return false;
+        }
+    }
+    writer.flush();
+    return writer.good();
+}
+
+static void removeFiles(const std::vector<std::string>& paths) {
+    for (const auto& path : paths) {
+        std::remove(path.c_str());
+    }
+}
+
+/**
+ * @brief Sorts a binary file of 32-bit ints that may be larger than memory.
+ * @param inputPath  File of raw native-endian int32 values.
+ * @param outputPath Where the sorted values are written (may not equal inputPath).
+ * @param config     Memory budget and directory for temporary run files.
+ * @param stats      Receives per-phase timings and I/O volume.
+ * @return true on success, false if a file could not be read or written or
+ *         the budget is below EXTERNAL_SORT_MIN_BUDGET_BYTES (192 KiB).
+ */
+bool externalSort(const std::string& inputPath, const std::string& outputPath,
+                  const ExternalSortConfig& config, ExternalSortStats& stats) {
+    stats = ExternalSortStats();
+    auto phaseStart = std::chrono::steady_clock::now();
+
+    std::ifstream in(inputPath, std::ios::binary);
+    if (!in) {
+        std::cerr << "Error opening file for reading: " << inputPath << std::endl;
+        return false;
+    }
+
+    if (config.memoryBudgetBytes < EXTERNAL_SORT_MIN_BUDGET_BYTES) {
+        std::cerr << "Error: memory budget must be at least " << EXTERNAL_SORT_MIN_BUDGET_BYTES << " bytes"
+                  << std::endl;
+        return false;
+    }
+
+    // Radix sort needs a scratch buffer as big as the chunk, so a chunk may use
+    // half of the budget.
+    size_t chunkElements = config.memoryBudgetBytes / 2 / sizeof(int);
+    // Every merge input and the output get at least EXTERNAL_SORT_MIN_BUFFER_BYTES;
+    // more runs than that are merged in extra passes.
+    size_t maxFanIn = std::max<size_t>(config.memoryBudgetBytes / EXTERNAL_SORT_MIN_BUFFER_BYTES, 3) - 1;
+
+    // Temp file names carry a timestamp so concurrent sorts do not collide.
+    std::string prefix = config.tempDir + "/extsort_" +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "_";
+    size_t nextRunId = 0;
+    std::vector<std::string> runs;
+
+    // --- Phase 1: run formation ---
+    {
+        std::vector<int> chunk(chunkElements);
+        while (in) {
+            in.read(reinterpret_cast<char*>(chunk.data()), chunkElements * sizeof(int));
+            std::streamsize got = in.gcount();
+            if (got <= 0) break;
+            stats.bytesRead += static_cast<uint64_t>(got);
+
+            size_t count = static_cast<size_t>(got) / sizeof(int);
+            chunk.resize(count);
+            radixSort(chunk);
+            stats.elements += count;
+
+            std::string path = prefix + std::to_string(nextRunId++) + ".run";
+            RunWriter writer(path, 0, stats);
+            writer.write(chunk.data(), count);
+            if (!writer.good()) {
+                std::cerr << "Error writing run file: " << path << std::endl;
+                removeFiles(runs);
+                std::remove(path.c_str());
+                return false;
+            }
+            runs.push_back(path);
+            chunk.resize(chunkElements);
+        }
+    }
+    stats.runs = runs.size();
+    auto now = std::chrono::steady_clock::now();
+    stats.runFormationSeconds = std::chrono::duration<double>(now - phaseStart).count();
+    stats.runFormationBytes = stats.bytesRead + stats.bytesWritten;
+    phaseStart = now;
+
+    // --- Phase 2: k-way merge, in several passes if there are too many runs ---
+    while (runs.size() > maxFanIn) {
+        std::vector<std::string> merged;
+        for (size_t i = 0; i < runs.size(); i += maxFanIn) {
+            std::vector<std::string> group(runs.begin() + i, runs.begin() + std::min(runs.size(), i + maxFanIn));
+            std::string path = prefix + std::to_string(nextRunId++) + ".run";
+            if (!mergeRuns(group, path, config.memoryBudgetBytes, stats)) {
+                removeFiles(runs);
+                removeFiles(merged);
+                std::remove(path.c_str());
+                return false;
+            }
+            merged.push_back(path);
+        }
+        removeFiles(runs);
+        runs.swap(merged);
+        stats.mergePasses++;
+    }
+
+    bool ok = mergeRuns(runs, outputPath, config.memoryBudgetBytes, stats);
+    stats.mergePasses++;
+    removeFiles(runs);
+
+    now = std::chrono::steady_clock::now();
+    stats.mergeSeconds = std::chrono::duration<double>(now - phaseStart).count();
+    stats.mergeBytes = stats.bytesRead + stats.bytesWritten - stats.runFormationBytes;
+    return ok;
+}
+
+/**
+ * @brief Prints the per-phase report of an external sort.
+ */
+void printExternalSortStats(const ExternalSortStats& stats) {
+    const double MB = 1024.0 * 1024.0;
+    std::cout << "Elements sorted    : " << stats.elements << "\n";
+    std::cout << "Sorted runs        : " << stats.runs << "\n";
+    std::cout << "Run formation      : " << stats.runFormationSeconds << " s, "
+              << stats.runFormationBytes / MB << " MB moved\n";
+    std::cout << "Merge passes       : " << stats.mergePasses << "\n";
+    std::cout << "Merge              : " << stats.mergeSeconds << " s, "
+              << stats.mergeBytes / MB << " MB moved\n";
+    std::cout << "Total I/O          : " << stats.bytesRead / MB << " MB read, "
+              << stats.bytesWritten / MB << " MB written\n";
+}
+
+/**
+ * @brief Generates a random int32 file, sorts it externally and verifies the output.
+ */
+static void externalSortDemo() {
+    size_t count = 0;
+    size_t budgetMB = 0;
+    std::cout << "\nNumber of random ints to generate (e.g. 10000000): ";
+    std::cin >> count;
+    std::cout << "Memory budget in MB (e.g. 8): ";
+    std::cin >> budgetMB;
+    if (std::cin.fail() || count == 0 || budgetMB == 0) {
+        std::cout << "Invalid input.\n";
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        return;
+    }
+
+    const std::string inputPath = "extsort_input.bin";
+    const std::string outputPath = "extsort_output.bin";
+    {
+        std::ofstream out(inputPath, std::ios::binary | std::ios::trunc);
+        std::mt19937 rng(7);
+        std::vector<int> block(1 << 16);
+        for (size_t done = 0; done < count; done += block.size()) {
+            size_t n = std::min(block.size(), count - done);
+            for (size_t i = 0; i < n; ++i) block[i] = static_cast<int>(rng());
+            out.write(reinterpret_cast<const char*>(block.data()), n * sizeof(int));
+        }
+    }
+
+    ExternalSortConfig config;
+    config.memoryBudgetBytes = budgetMB * 1024 * 1024;
+    ExternalSortStats stats;
+    if (externalSort(inputPath, outputPath, config, stats)) {
+        printExternalSortStats(stats);
+
+        // Verify: the output must be non-decreasing and hold every element.
+        std::ifstream check(outputPath, std::ios::binary);
+        std::vector<int> block(1 << 16);
+        size_t seen = 0;
+        bool sorted = true;
+        int prev = std::numeric_limits<int>::min();
+        while (check) {
+            check.read(reinterpret_cast<char*>(block.data()), block.size() * sizeof(int));
+            size_t n = static_cast<size_t>(check.gcount()) / sizeof(int);
+            for (size_t i = 0; i < n; ++i) {
+                if (block[i] < prev) sorted = false;
+                prev = block[i];
+            }
+            seen += n;
+        }
+        std::cout << "Output check       : " << ((sorted && seen == count) ? "sorted, all elements present" : "FAILED") << "\n";
+    }
+    std::remove(inputPath.c_str());
+    std::remove(outputPath.c_str());
+}
+
+// 11. Generic Sort API (see generic_sortEx.h)
+
+/**
+ * @brief Sorts Task, Student and Vector2D records with the header-only templates.
+ */
+static void genericSortDemo() {
+    std::vector<Task> tasks = {
+        {1, false, 3, "Write report", "Quarterly numbers", "2025-03-10"},
+        {2, false, 1, "Fix login bug", "Users cannot log in", "2025-03-01"},
+        {3, true, 5, "Clean desk", "", "2025-04-01"},
+        {4, false, 1, "Deploy hotfix", "After the bug fix", "2025-03-02"},
+        {5, false, 2, "Review PR", "Sorting module", "2025-03-05"},
+    };
+
+    // Integral key -> radix sort. Stable: equal priorities keep their order.
+    sortBy(tasks.begin(), tasks.end(), &Task::priority);
+    std::cout << "\nTasks by priority (radix path):\n";
+    for (const auto& t : tasks) {
+        std::cout << "  [" << t.priority << "] " << t.title << "\n";
+    }
+
+    // std::string key -> introsort.
+    sortBy(tasks.begin(), tasks.end(), [](const Task& t) { return t.dueDate; });
+    std::cout << "Tasks by due date (comparison path):\n";
+    for (const auto& t : tasks) {
+        std::cout << "  " << t.dueDate << " " << t.title << "\n";
+    }
+
+    // argsort: the records are never moved, only their indices.
+    std::vector<Student> students = {
+        {"Kim", 1001, 3.7f}, {"Lee", 1002, 4.1f}, {"Park", 1003, 3.2f}, {"Choi", 1004, 3.9f}};
+    std::vector<size_t> order = argsortBy(students.begin(), students.end(), &Student::gpa);
+    std::cout << "Students by GPA (argsort):";
+    for (size_t i : order) {
+        std::cout << " " << students[i].name << "(" << students[i].gpa << ")";
+    }
+    std::cout << "\n";
+
+    // Custom comparator: points by distance from the origin.
+    std::vector<Vector2D> points = {{3.0f, 4.0f}, {1.0f, 1.0f}, {-2.0f, 0.5f}, {0.0f, 6.0f}};
+    sortRange(points.begin(), points.end(), [](const Vector2D& a, const Vector2D& b) {
+        return a.x * a.x + a.y * a.y < b.x * b.x + b.y * b.y;
+    });
+    std::cout << "Points by distance:";
+    for (const auto& p : points) {
+        std::cout << " (" << p.x << ", " << p.y << ")";
+    }
+    std::cout << "\n";
+}
+
+// 12. Dual-Pivot Quick Sort with three-way partitioning
+//
+// Inputs like Task::priority (1..5) or short status codes contain long runs
+// of equal keys. The Lomuto partition above puts every key equal to the pivot
+// on one side, so such input becomes O(n^2). This variant (after Yaroslavskiy's
+// dual-pivot quicksort) picks two pivots p1 <= p2 and splits the range into
+//     [ < p1 | p1 <= x <= p2 | > p2 ]
+// - If p1 == p2 the middle part holds only copies of the pivot: it is already
+//   sorted and is not recursed into.
+// - If the middle part is large, a Dutch-national-flag pass moves the keys
+//   equal to p1 to its left end and the keys equal to p2 to its right end, so
+//   only the strictly-between keys are recursed into.
+// A range with k distinct keys is therefore finished after about log(k) levels.
+
+/**
+ * @brief Picks two pivots from five evenly spaced samples and moves the 2nd
+ * smallest sample to *first and the 4th smallest to *(last - 1).
+ */
+static void chooseDualPivots(int* first, int* last) {
+    std::ptrdiff_t n = last - first;
+    std::ptrdiff_t seventh = n / 7;
+    int* mid = first + n / 2;
+    int* e[5] = {mid - 2 * seventh, mid - seventh, mid, mid + seventh, mid + 2 * seventh};
+
+    // Insertion sort of the five samples (in place in the array).
+    for (int i = 1; i < 5; ++i) {
+        for (int j = i; j > 0 && *e[j] < *e[j - 1]; --j) {
+            std::swap(*e[j], *e[j - 1]);
+        }
+    }
+    std::swap(*first, *e[1]);
+    std::swap(*(last - 1), *e[3]);
+}
+
+static void dualPivotQuickSortLoop(int* first, int* last, int depthLimit, std::ptrdiff_t cutoff) {
+    while (last - first > cutoff) {
+        if (depthLimit == 0) {
+            heapSortRange(first, last);
+            return;
+        }
+        --depthLimit;
+
+        std::ptrdiff_t n = last - first;
+        chooseDualPivots(first, last);
+        int p1 = *first;
+        int p2 = *(last - 1);
+
+        // Partition (first, last - 1) into < p1 | [p1, p2] | > p2.
+        int* less = first + 1;   // next slot for an element < p1
+        int* great = last - 2;   // next slot for an element > p2
+        for (int* k = less; k <= great; ++k) {
+            int value = *k;
+            if (value < p1) {
+                std::swap(*k, *less);
+                ++less;
+            } else if (value > p2) {
+                while (*great > p2 && k < great) --great;
+                std::swap(*k, *great);
+                --great;
+                if (*k < p1) {
+                    std::swap(*k, *less);
+                    ++less;
+                }
+            }
+        }
+        // Move the pivots between the parts.
+        --less;
+        ++great;
+        std::swap(*first, *less);
+        std::swap(*(last - 1), *great);
+
+        // [first, less) < p1, *less == p1, (less, great) in [p1, p2], *great == p2, (great, last) > p2
+        int* midFirst = less + 1;
+        int* midLast = great;
+        if (p1 == p2) {
+            midLast = midFirst; // Every middle key equals the pivot: nothing left to sort.
+        } else if ((midLast - midFirst) > n * 4 / 7) {
+            // Dutch national flag: == p1 to the left, == p2 to the right.
+            int* lt = midFirst;
+            int* gt = midLast - 1;
+            int* k = midFirst;
+            while (k <= gt) {
+                if (*k == p1) {
+                    std::swap(*k, *lt);
+                    ++lt;
+                    ++k;
+                } else if (*k == p2) {
+                    std::swap(*k, *gt);
+                    --gt;
+                } else {
+                    ++k;
+                }
+            }
+            midFirst = lt;
+            midLast = gt + 1;
+        }
+
+        // Recurse into the two smaller parts, loop on the largest one.
+        int* parts[3][2] = {{first, less}, {midFirst, midLast}, {great + 1, last}};
+        int largest = 0;
+        for (int i = 1; i < 3; ++i) {
+            if (parts[i][1] - parts[i][0] > parts[largest][1] - parts[largest][0]) largest = i;
+        }
+        for (int i = 0; i < 3; ++i) {
+            if (i != largest) dualPivotQuickSortLoop(parts[i][0], parts[i][1], depthLimit, cutoff);
+        }
+        first = parts[largest][0];
+        last = parts[largest][1];
+    }
+    sortNetwork(first, last);
+}
+
+/**
+ * @brief Sorts arr[low..high] (inclusive) with dual-pivot three-way quicksort.
+ * Same signature as quickSort so they can be compared directly.
+ */
+void dualPivotQuickSort(std::vector<int>& arr, int low, int high) {
+    if (low >= high) return;
+
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) {
+        depthLimit += 2;
+    }
+    dualPivotQuickSortLoop(arr.data() + low, arr.data() + high + 1, depthLimit,
+                           static_cast<std::ptrdiff_t>(sortNetworkLimit()));
+}
+
+/**
+ * @brief Times the quicksort variants on inputs with 5, 100 and 10^4 distinct keys.
+ */
+static void duplicateKeysBenchmark() {
+    const int n = 2000000;
+    const int smallN = 20000; // Lomuto quickSort is O(n^2) here: keep its input small
+    const int distinctCounts[] = {5, 100, 10000};
+    std::mt19937 rng(11);
+
+    std::cout << std::setfill(' '); // the main menu leaves '0' as the fill character
+    std::cout << "\nBenchmark: " << n << " ints with few distinct keys (ms)\n";
+    std::cout << "distinct | dual-pivot | introSort | pdqSort | std::sort | Lomuto (n=" << smallN << ")\n";
+    for (int distinct : distinctCounts) {
+        std::vector<int> input(n);
+        for (int& x : input) x = static_cast<int>(rng() % distinct);
+        std::vector<int> expected = input;
+        std::sort(expected.begin(), expected.end());
+
+        auto timeSort = [&](auto sortFn, const std::vector<int>& source) {
+            std::vector<int> work = source;
+            auto start = std::chrono::steady_clock::now();
+            sortFn(work);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (!std::is_sorted(work.begin(), work.end())) ms = -1.0; // -1 marks a wrong result
+            return ms;
+        };
+
+        double dual = timeSort([](std::vector<int>& v) { dualPivotQuickSort(v, 0, static_cast<int>(v.size()) - 1); }, input);
+        double intro = timeSort([](std::vector<int>& v) { introSort(v); }, input);
+        double pdq = timeSort([](std::vector<int>& v) { pdqSort(v, 0, static_cast<int>(v.size()) - 1); }, input);
+        double stl = timeSort([](std::vector<int>& v) { std::sort(v.begin(), v.end()); }, input);
+        std::vector<int> small(input.begin(), input.begin() + smallN);
+        double lomuto = timeSort([](std::vector<int>& v) { quickSort(v, 0, static_cast<int>(v.size()) - 1); }, small);
+
+        std::cout << std::setw(8) << distinct << " | " << std::setw(10) << dual << " | " << std::setw(9) << intro
+                  << " | " << std::setw(7) << pdq << " | " << std::setw(9) << stl << " | " << lomuto << "\n";
+    }
+}
+
+// 13. Tim Sort (adaptive natural merge sort, see generic_sortEx.h)
+
+/**
+ * @brief Sorts the whole vector with Timsort. Near-linear on almost-sorted input.
+ */
+void timSort(std::vector<int>& arr) {
+    timSortRange(arr.begin(), arr.end(), std::less<int>());
+}
+
+/**
+ * @brief Times Timsort against the other sorts on sorted and nearly-sorted input.
+ */
+static void nearlySortedBenchmark() {
+    const int n = 2000000;
+    std::mt19937 rng(13);
+
+    std::vector<int> sortedInput(n);
+    for (int i = 0; i < n; ++i) sortedInput[i] = i;
+
+    // 1% of the positions swapped with a random partner (small edits).
+    std::vector<int> editedInput = sortedInput;
+    for (int i = 0; i < n / 100; ++i) {
+        std::swap(editedInput[rng() % n], editedInput[rng() % n]);
+    }
+
+    // Sorted log with 1% new random entries appended at the end.
+    std::vector<int> appendedInput = sortedInput;
+    for (int i = 0; i < n / 100; ++i) {
+        appendedInput[n - 1 - i] = static_cast<int>(rng() % n);
+    }
+
+    std::vector<int> reversedInput(sortedInput.rbegin(), sortedInput.rend());
+
+    struct Case {
+        const char* name;
+        const std::vector<int>* input;
+    };
+    const Case cases[] = {{"sorted", &sortedInput}, {"1% swapped", &editedInput},
+                          {"1% appended", &appendedInput}, {"reversed", &reversedInput}};
+
+    auto timeSort = [](auto sortFn, const std::vector<int>& source) {
+        std::vector<int> work = source;
+        auto start = std::chrono::steady_clock::now();
+        sortFn(work);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return std::is_sorted(work.begin(), work.end()) ? ms : -1.0; // -1 marks a wrong result
+    };
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nBenchmark: " << n << " ints, nearly sorted (ms)\n";
+    std::cout << "input       |  timSort | introSort |  pdqSort | stable_sort | std::sort\n";
+    for (const Case& c : cases) {
+        double tim = timeSort([](std::vector<int>& v) { timSort(v); }, *c.input);
+        double intro = timeSort([](std::vector<int>& v) { introSort(v); }, *c.input);
+        double pdq = timeSort([](std::vector<int>& v) { pdqSort(v, 0, static_cast<int>(v.size()) - 1); }, *c.input);
+        double stable = timeSort([](std::vector<int>& v) { std::stable_sort(v.begin(), v.end()); }, *c.input);
+        double stl = timeSort([](std::vector<int>& v) { std::sort(v.begin(), v.end()); }, *c.input);
+        std::cout << std::left << std::setw(11) << c.name << std::right << " | " << std::setw(8) << tim
+                  << " | " << std::setw(9) << intro << " | " << std::setw(8) << pdq << " | "
+                  << std::setw(11) << stable << " | " << stl << "\n";
+    }
+}
+
+// 14. Selection: Introselect (k-th element) and streaming Top-k
+//
+// Often we need only the k smallest/largest values or the median, not a fully
+// sorted array.
+// - introSelect() reuses the introsort partition, but after each partition it
+//   continues only into the side that holds position k: O(n) on average.
+//   If that takes too many rounds, pivots switch to median-of-medians, which
+//   keeps the worst case linear as well.
+// - StreamingTopK keeps a heap of the best k values seen so far, so data that
+//   arrives incrementally (or never fits in memory) needs only O(k) memory and
+//   O(n log k) time.
+
+const std::ptrdiff_t SELECT_INSERTION_THRESHOLD = 16;
+
+static void introSelectLoop(int* first, int* nth, int* last, int depthLimit);
+
+/**
+ * @brief Moves the median of the group-of-five medians of [first, last) to *first.
+ * Guarantees that at least ~30% of the range lies on each side of the pivot.
+ */
+static void medianOfMediansPivot(int* first, int* last) {
+    int* store = first;
+    for (int* group = first; group < last; group += 5) {
+        int* groupEnd = std::min(group + 5, last);
+        insertionSortRange(group, groupEnd);
+        std::swap(*store, *(group + (groupEnd - group) / 2));
+        ++store;
+    }
+    // The medians now sit in [first, store); select their median recursively.
+    int* mid = first + (store - first) / 2;
+    introSelectLoop(first, mid, store, 0);
+    std::swap(*first, *mid);
+}
+
+static void introSelectLoop(int* first, int* nth, int* last, int depthLimit) {
+    while (last - first > SELECT_INSERTION_THRESHOLD) {
+        if (depthLimit > 0) {
+            --depthLimit;
+            choosePivot(first, last);
+        } else {
+            medianOfMediansPivot(first, last); // Too many bad rounds: guaranteed-good pivot.
+        }
+
+        int* p = partitionAroundFirst(first, last);
+        if (p == nth) return;
+        if (nth < p) {
+            last = p;
+        } else {
+            first = p + 1;
+        }
+    }
+    insertionSortRange(first, last);
+}
+
+/**
+ * @brief Rearranges arr so that arr[k] is the value a full sort would put there,
+ * everything before it is <= arr[k] and everything after it is >= arr[k]
+ * (like std::nth_element). O(n) time.
+ */
+void introSelect(std::vector<int>& arr, size_t k) {
+    if (k >= arr.size()) return;
+
+    int depthLimit = 0;
+    for (size_t n = arr.size(); n > 1; n >>= 1) {
+        depthLimit += 2;
+    }
+    introSelectLoop(arr.data(), arr.data() + k, arr.data() + arr.size(), depthLimit);
+}
+
+StreamingTopK::StreamingTopK(size_t k, bool largest) : k(k), largest(largest) {
+    heap.reserve(k);
+}
+
+void StreamingTopK::push(int value) {
+    if (k == 0) return;
+    // Ordered by 'better', the heap's root is the worst value kept (the smallest
+    // of the k largest), so a new value only has to beat the root to get in.
+    auto better = [this](int a, int b) { return largest ? a > b : a < b; };
+    if (heap.size() < k) {
+        heap.push_back(value);
+        std::push_heap(heap.begin(), heap.end(), better);
+    } else if (better(value, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), better);
+        heap.back() = value;
+        std::push_heap(heap.begin(), heap.end(), better);
+    }
+}
+
+std::vector<int> StreamingTopK::sorted() const {
+    std::vector<int> result = heap;
+    std::sort(result.begin(), result.end());
+    if (largest) {
+        std::reverse(result.begin(), result.end());
+    }
+    return result;
+}
+
+/**
+ * @brief Times introSelect and StreamingTopK against quickSort + slicing.
+ */
+static void selectionBenchmark() {
+    const int n = 5000000;
+    const size_t k = 100;
+    std::mt19937 rng(17);
+    std::vector<int> input(n);
+    for (int& x : input) x = static_cast<int>(rng());
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // Reference: full quickSort, then slice.
+    std::vector<int> sortedCopy = input;
+    auto start = std::chrono::steady_clock::now();
+    quickSort(sortedCopy, 0, n - 1);
+    double sortMs = elapsedMs(start);
+    int expectedMedian = sortedCopy[n / 2];
+    std::vector<int> expectedTop(sortedCopy.rbegin(), sortedCopy.rbegin() + k);
+
+    std::vector<int> work = input;
+    start = std::chrono::steady_clock::now();
+    introSelect(work, n / 2);
+    double medianMs = elapsedMs(start);
+    bool medianOk = work[n / 2] == expectedMedian;
+
+    work = input;
+    start = std::chrono::steady_clock::now();
+    introSelect(work, n - k); // The k largest end up in the last k slots.
+    std::vector<int> selectedTop(work.begin() + (n - k), work.end());
+    std::sort(selectedTop.rbegin(), selectedTop.rend());
+    double selectTopMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<int> streamedTop = streamTopK(input.begin(), input.end(), k, true);
+    double streamMs = elapsedMs(start);
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nBenchmark: " << n << " random ints\n";
+    std::cout << "  quickSort + slice (median & top-" << k << "): " << sortMs << " ms\n";
+    std::cout << "  introSelect median                 : " << medianMs << " ms"
+              << (medianOk ? "" : " (WRONG)") << "\n";
+    std::cout << "  introSelect top-" << k << " (+ sort k)       : " << selectTopMs << " ms"
+              << (selectedTop == expectedTop ? "" : " (WRONG)") << "\n";
+    std::cout << "  StreamingTopK top-" << k << "               : " << streamMs << " ms"
+              << (streamedTop == expectedTop ? "" : " (WRONG)") << "\n";
+}
+
+// 15. Multikey Quick Sort for strings (Task titles, due dates, ...)
+//
+// std::sort on std::string compares whole strings through heap pointers and
+// re-reads the shared prefix on every comparison. Multikey quicksort (Bentley &
+// Sedgewick) partitions three ways on one "character" at a time and only
+// advances to the next character inside the group of equal ones.
+// Here a character is an inline 8-byte key: the next 7 bytes of the string in
+// big-endian order plus a length tag in the low byte, so most partitioning
+// work compares plain integers and never touches the string data.
+// The tag is min(bytes left, 8); 8 means "the string continues", so equal keys
+// with a smaller tag belong to identical strings and are ordered by their
+// original index, which keeps the sort stable.
+
+const std::ptrdiff_t STRING_SORT_INSERTION_THRESHOLD = 16;
+const size_t STRING_KEY_BYTES = 7;
+const uint64_t STRING_KEY_CONTINUES = 8;
+const std::ptrdiff_t STRING_PREFETCH_DISTANCE = 16;
+
+struct StringSortItem {
+    uint64_t key;   // cached bytes [depth, depth + 7) plus length tag
+    size_t index;   // position in the caller's key list (the struct is 16 bytes either way)
+};
+
+static inline uint64_t stringChunkKey(std::string_view s, size_t depth) {
+    size_t remaining = s.size() > depth ? s.size() - depth : 0;
+    size_t take = std::min(remaining, STRING_KEY_BYTES);
+    uint64_t key = 0;
+    if (remaining >= 8) {
+        // Common case: one unaligned 8-byte load, then bytes into big-endian order.
+        unsigned char bytes[8];
+        std::memcpy(bytes, s.data() + depth, 8);
+        for (size_t i = 0; i < STRING_KEY_BYTES; ++i) {
+            key |= static_cast<uint64_t>(bytes[i]) << (56 - 8 * i);
+        }
+        return key | STRING_KEY_CONTINUES;
+    }
+    for (size_t i = 0; i < take; ++i) {
+        key |= static_cast<uint64_t>(static_cast<unsigned char>(s[depth + i])) << (56 - 8 * i);
+    }
+    return key | std::min<uint64_t>(remaining, STRING_KEY_CONTINUES);
+}
+
+/**
+ * @brief Full comparison of two items whose strings match before 'depth'.
+ */
+static inline bool stringItemLess(const StringSortItem& a, const StringSortItem& b,
+                                  const std::vector<std::string_view>& keys, size_t depth) {
+    if (a.key != b.key) return a.key < b.key;
+    if ((a.key & 0xFF) == STRING_KEY_CONTINUES) {
+        int cmp = keys[a.index].substr(depth).compare(keys[b.index].substr(depth));
+        if (cmp != 0) return cmp < 0;
+    }
+    return a.index < b.index;
+}
+
+static void multikeyQuickSort(StringSortItem* first, StringSortItem* last,
+                              const std::vector<std::string_view>& keys, size_t depth, int depthLimit) {
+    while (last - first > STRING_SORT_INSERTION_THRESHOLD) {
+        if (depthLimit == 0) {
+            // Too many unbalanced rounds: finish with full string comparisons.
+            std::sort(first, last, [&](const StringSortItem& a, const StringSortItem& b) {
+                return stringItemLess(a, b, keys, depth);
+            });
+            return;
+        }
+
+        // Median-of-three pivot on the cached keys.
+        uint64_t a = first->key, b = first[(last - first) / 2].key, c = last[-1].key;
+        uint64_t pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+        // Three-way partition: [first, lt) < pivot, [lt, gt) == pivot, [gt, last) > pivot.
+        StringSortItem* lt = first;
+        StringSortItem* gt = last;
+        StringSortItem* i = first;
+        while (i < gt) {
+            if (i->key < pivot) {
+                std::swap(*lt++, *i++);
+            } else if (i->key > pivot) {
+                std::swap(*i, *--gt);
+            } else {
+                ++i;
+            }
+        }
+
+        if (lt != first || gt != last) {
+            --depthLimit;
+            multikeyQuickSort(first, lt, keys, depth, depthLimit);
+            multikeyQuickSort(gt, last, keys, depth, depthLimit);
+        }
+
+        if ((pivot & 0xFF) != STRING_KEY_CONTINUES) {
+            // Identical strings: restore input order.
+            std::sort(lt, gt, [](const StringSortItem& x, const StringSortItem& y) { return x.index < y.index; });
+            return;
+        }
+
+        // Continue with the next 7 bytes inside the equal group (a loop, not
+        // recursion, so long shared prefixes cost no stack).
+        depth += STRING_KEY_BYTES;
+        for (StringSortItem* item = lt; item < gt; ++item) {
+#if defined(__GNUC__)
+            // The strings are scattered over the heap; start fetching a few ahead.
+            if (gt - item > STRING_PREFETCH_DISTANCE) {
+                __builtin_prefetch(keys[item[STRING_PREFETCH_DISTANCE].index].data() + depth);
+            }
+#endif
+            item->key = stringChunkKey(keys[item->index], depth);
+        }
+        first = lt;
+        last = gt;
+    }
+
+    // Small range: insertion sort with full comparisons.
+    for (StringSortItem* i = first + 1; i < last; ++i) {
+        StringSortItem value = *i;
+        StringSortItem* j = i;
+        while (j > first && stringItemLess(value, j[-1], keys, depth)) {
+            *j = j[-1];
+            --j;
+        }
+        *j = value;
+    }
+}
+
+/**
+ * @brief Returns the permutation that sorts 'keys' (stable, byte-wise order).
+ */
+std::vector<size_t> stringArgsort(const std::vector<std::string_view>& keys) {
+    std::vector<StringSortItem> items(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        items[i] = {stringChunkKey(keys[i], 0), i};
+    }
+
+    int depthLimit = 0;
+    for (size_t n = keys.size(); n > 1; n >>= 1) {
+        depthLimit += 2;
+    }
+    multikeyQuickSort(items.data(), items.data() + items.size(), keys, 0, depthLimit);
+
+    std::vector<size_t> order(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        order[i] = items[i].index;
+    }
+    return order;
+}
+
+/**
+ * @brief Moves the elements of 'values' into the order given by a permutation.
+ */
+template <typename T>
+static void applyOrder(std::vector<T>& values, const std::vector<size_t>& order) {
+    std::vector<T> sortedValues;
+    sortedValues.reserve(values.size());
+    for (size_t index : order) {
+        sortedValues.push_back(std::move(values[index]));
+    }
+    values = std::move(sortedValues);
+}
+
+void stringSort(std::vector<std::string>& strs) {
+    std::vector<std::string_view> keys(strs.begin(), strs.end());
+    applyOrder(strs, stringArgsort(keys));
+}
+
+void sortTasksByTitle(std::vector<Task>& tasks) {
+    std::vector<std::string_view> keys;
+    keys.reserve(tasks.size());
+    for (const Task& task : tasks) {
+        keys.push_back(task.title);
+    }
+    applyOrder(tasks, stringArgsort(keys));
+}
+
+void sortTasksByDueDate(std::vector<Task>& tasks) {
+    std::vector<std::string_view> keys;
+    keys.reserve(tasks.size());
+    for (const Task& task : tasks) {
+        keys.push_back(task.dueDate);
+    }
+    applyOrder(tasks, stringArgsort(keys));
+}
+
+/**
+ * @brief Sorts a small task list by title and due date, then times the string
+ * sort against std::sort / std::stable_sort on a large generated task export.
+ */
+static void stringSortDemo() {
+    std::vector<Task> tasks = {
+        {1, false, 2, "Write report", "", "2024-07-15"},
+        {2, true, 1, "Buy groceries", "", "2024-07-01"},
+        {3, false, 3, "Book flights", "", "2024-08-20"},
+        {4, false, 1, "Write release notes", "", "2024-07-01"},
+        {5, false, 5, "Call plumber", "", "2024-06-30"},
+    };
+
+    sortTasksByTitle(tasks);
+    std::cout << "\nTasks by title:\n";
+    for (const Task& task : tasks) {
+        std::cout << "  " << task.title << " (" << task.dueDate << ")\n";
+    }
+    sortTasksByDueDate(tasks);
+    std::cout << "Tasks by due date (ties keep title order):\n";
+    for (const Task& task : tasks) {
+        std::cout << "  " << task.dueDate << " " << task.title << "\n";
+    }
+
+    // A realistic export: titles share long prefixes, dates share "2024-".
+    const int n = 300000;
+    const char* verbs[] = {"Fix bug in ", "Review ", "Write tests for ", "Refactor ", "Update docs for "};
+    const char* modules[] = {"sorting module", "search module", "hash table", "task manager", "file io"};
+    std::mt19937 rng(15);
+    std::vector<Task> bigTasks(n);
+    for (int i = 0; i < n; ++i) {
+        bigTasks[i].id = i;
+        bigTasks[i].title = std::string(verbs[rng() % 5]) + modules[rng() % 5] + " #" + std::to_string(rng() % 100000);
+        char date[16];
+        std::snprintf(date, sizeof(date), "2024-%02u-%02u", static_cast<unsigned>(1 + rng() % 12),
+                      static_cast<unsigned>(1 + rng() % 28));
+        bigTasks[i].dueDate = date;
+    }
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    auto byTitle = [](const Task& a, const Task& b) { return a.title < b.title; };
+    auto byDueDate = [](const Task& a, const Task& b) { return a.dueDate < b.dueDate; };
+    auto sameOrder = [](const std::vector<Task>& a, const std::vector<Task>& b) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i].id != b[i].id) return false;
+        }
+        return true;
+    };
+
+    std::vector<std::string> titles;
+    for (const Task& task : bigTasks) titles.push_back(task.title);
+    std::vector<std::string> work = titles;
+    auto start = std::chrono::steady_clock::now();
+    stringSort(work);
+    double mkqsMs = elapsedMs(start);
+    std::vector<std::string> expected = titles;
+    start = std::chrono::steady_clock::now();
+    std::sort(expected.begin(), expected.end());
+    double stdMs = elapsedMs(start);
+
+    std::vector<Task> titleWork = bigTasks;
+    start = std::chrono::steady_clock::now();
+    sortTasksByTitle(titleWork);
+    double titleMs = elapsedMs(start);
+    std::vector<Task> titleExpected = bigTasks;
+    start = std::chrono::steady_clock::now();
+    std::stable_sort(titleExpected.begin(), titleExpected.end(), byTitle);
+    double titleStdMs = elapsedMs(start);
+
+    std::vector<Task> dateWork = bigTasks;
+    start = std::chrono::steady_clock::now();
+    sortTasksByDueDate(dateWork);
+    double dateMs = elapsedMs(start);
+    std::vector<Task> dateExpected = bigTasks;
+    start = std::chrono::steady_clock::now();
+    std::stable_sort(dateExpected.begin(), dateExpected.end(), byDueDate);
+    double dateStdMs = elapsedMs(start);
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nBenchmark: " << n << " tasks (ms)\n";
+    std::cout << "key                 | multikey | std::sort / stable_sort\n";
+    std::cout << "std::string titles  | " << std::setw(8) << mkqsMs << " | " << stdMs
+              << (work == expected ? "" : " (WRONG)") << "\n";
+    std::cout << "Task by title       | " << std::setw(8) << titleMs << " | " << titleStdMs
+              << (sameOrder(titleWork, titleExpected) ? "" : " (WRONG)") << "\n";
+    std::cout << "Task by due date    | " << std::setw(8) << dateMs << " | " << dateStdMs
+              << (sameOrder(dateWork, dateExpected) ? "" : " (WRONG)") << "\n";
+}
+
+// 16. Operation counting (comparisons, moves, recursion depth)
+//
+// Wall time depends on the machine; operation counts show the algorithm
+// itself: ~n log2 n comparisons for a good quicksort, n^2 / 2 for a bad pivot,
+// about n - 1 for Timsort on sorted input, and how deep the recursion gets.
+
+SortStats quickSortCounted(std::vector<int>& arr) {
+    CountingSortInstrumentation::reset();
+    quickSortLomuto<CountingSortInstrumentation>(arr, 0, static_cast<int>(arr.size()) - 1);
+    return CountingSortInstrumentation::stats();
+}
+
+SortStats quickSortHoareCounted(std::vector<int>& arr) {
+    CountingSortInstrumentation::reset();
+    quickSortHoareLoop<CountingSortInstrumentation>(arr, 0, static_cast<int>(arr.size()) - 1);
+    return CountingSortInstrumentation::stats();
+}
+
+SortStats introSortCounted(std::vector<int>& arr) {
+    CountingSortInstrumentation::reset();
+    introSortVector<CountingSortInstrumentation>(arr);
+    return CountingSortInstrumentation::stats();
+}
+
+SortStats timSortCounted(std::vector<int>& arr) {
+    CountingSortInstrumentation::reset();
+    timSortRange<CountingSortInstrumentation>(arr.begin(), arr.end(), std::less<int>());
+    return CountingSortInstrumentation::stats();
+}
+
+/**
+ * @brief Prints comparisons and moves per element and the maximum depth of the
+ * counted sorts on a few input shapes.
+ */
+static void operationCountsDemo() {
+    // Small enough that the O(n^2) cases of the plain quick sorts finish quickly.
+    const int n = 10000;
+    std::mt19937 rng(16);
+
+    std::vector<int> randomInput(n);
+    for (int& x : randomInput) x = static_cast<int>(rng());
+    std::vector<int> sortedInput(n);
+    for (int i = 0; i < n; ++i) sortedInput[i] = i;
+    std::vector<int> fewUniqueInput(n);
+    for (int& x : fewUniqueInput) x = static_cast<int>(rng() % 4);
+
+    struct Case {
+        const char* name;
+        const std::vector<int>* input;
+    };
+    const Case cases[] = {{"random", &randomInput}, {"sorted", &sortedInput}, {"few-unique", &fewUniqueInput}};
+
+    struct Algorithm {
+        const char* name;
+        SortStats (*sort)(std::vector<int>&);
+    };
+    const Algorithm algorithms[] = {{"quickSort", quickSortCounted},
+                                    {"quickSortHoare", quickSortHoareCounted},
+                                    {"introSort", introSortCounted},
+                                    {"timSort", timSortCounted}};
+
+    std::cout << std::setfill(' ');
+    std::cout << "\nOperation counts, n = " << n << " (log2 n = 13.3)\n";
+    std::cout << "input       | algorithm      | compares/n |   moves/n | max depth\n";
+    for (const Case& c : cases) {
+        for (const Algorithm& algo : algorithms) {
+            std::vector<int> work = *c.input;
+            SortStats stats = algo.sort(work);
+            bool ok = std::is_sorted(work.begin(), work.end());
+            std::cout << std::left << std::setw(11) << c.name << " | " << std::setw(14) << algo.name << std::right
+                      << " | " << std::setw(10) << static_cast<double>(stats.comparisons) / n << " | "
+                      << std::setw(9) << static_cast<double>(stats.moves) / n << " | " << stats.maxDepth
+                      << (ok ? "" : " (WRONG)") << "\n";
+        }
+    }
 }
 
 void sorting_algorithmsEx(void) {
@@ -101,7 +2042,7 @@ void sorting_algorithmsEx(void) {
     std::vector<int> data = {64, 34, 25, 12, 22, 11, 90, 5};
     int choice = 0;
 
-    while (choice != 5) {
+    while (choice != 17) {
         std::cout << "\n--- Sort Menu ---\n";
         printSortVector("Original Data: ", data);
 
@@ -109,18 +2050,30 @@ void sorting_algorithmsEx(void) {
         std::cout << "2. Selection Sort\n";
         std::cout << "3. Quick Sort (Lomuto)\n";
         std::cout << "4. Quick Sort (Hoare)\n";
-        std::cout << "5. Back to main menu\n";
+        std::cout << "5. Intro Sort\n";
+        std::cout << "6. Pattern-Defeating Quick Sort (pdqsort)\n";
+        std::cout << "7. Radix Sort (LSD, 8-bit digits)\n";
+        std::cout << "8. Parallel Sample Sort (multi-threaded)\n";
+        std::cout << "9. External Merge Sort (file larger than RAM)\n";
+        std::cout << "10. SIMD Sorting Network (up to 64 ints)\n";
+        std::cout << "11. Generic Sort API (Task / Student / Vector2D)\n";
+        std::cout << "12. Dual-Pivot Quick Sort (3-way, duplicate keys)\n";
+        std::cout << "13. Tim Sort (adaptive, nearly-sorted data)\n";
+        std::cout << "14. Selection: k-th element / streaming Top-k\n";
+        std::cout << "15. String Sort: tasks by title / due date\n";
+        std::cout << "16. Operation counts (comparisons, moves, depth)\n";
+        std::cout << "17. Back to main menu\n";
         std::cout << "Enter your choice: ";
         std::cin >> choice;
 
-        if (std::cin.fail() || choice < 1 || choice > 5) {
-            std::cout << "\nInvalid input. Please enter a number between 1 and 5.\n";
+        if (std::cin.fail() || choice < 1 || choice > 17) {
+            std::cout << "\nInvalid input. Please enter a number between 1 and 17.\n";
             std::cin.clear();
             std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
             continue;
         }
 
-        if (choice == 5) break;
+        if (choice == 17) break;
 
         std::vector<int> sorted_data = data;
         if (choice == 1) {
@@ -135,6 +2088,51 @@ void sorting_algorithmsEx(void) {
         } else if (choice == 4) {
             quickSortHoare(sorted_data, 0, static_cast<int>(sorted_data.size() - 1));
             printSortVector("Quick Sorted (Hoare): ", sorted_data);
+        } else if (choice == 5) {
+            introSort(sorted_data);
+            printSortVector("Intro Sorted: ", sorted_data);
+        } else if (choice == 6) {
+            pdqSort(sorted_data, 0, static_cast<int>(sorted_data.size() - 1));
+            printSortVector("pdqsort Sorted: ", sorted_data);
+        } else if (choice == 7) {
+            radixSort(sorted_data);
+            printSortVector("Radix Sorted: ", sorted_data);
+        } else if (choice == 8) {
+            parallelSampleSort(sorted_data);
+            printSortVector("Sample Sorted: ", sorted_data);
+            parallelSampleSortDemo();
+        } else if (choice == 9) {
+            externalSortDemo();
+        } else if (choice == 10) {
+            std::cout << "Kernel: " << sortNetworkIsa() << " (sorts up to " << sortNetworkLimit() << " ints)\n";
+            sortNetwork(sorted_data.data(), sorted_data.data() + sorted_data.size());
+            printSortVector("Network Sorted: ", sorted_data);
+        } else if (choice == 11) {
+            genericSortDemo();
+        } else if (choice == 12) {
+            dualPivotQuickSort(sorted_data, 0, static_cast<int>(sorted_data.size() - 1));
+            printSortVector("Dual-Pivot Sorted: ", sorted_data);
+            duplicateKeysBenchmark();
+        } else if (choice == 13) {
+            timSort(sorted_data);
+            printSortVector("Tim Sorted: ", sorted_data);
+            nearlySortedBenchmark();
+        } else if (choice == 14) {
+            size_t k = sorted_data.size() / 2;
+            introSelect(sorted_data, k);
+            std::cout << "Median (k = " << k << "): " << sorted_data[k] << "\n";
+            printSortVector("After introSelect: ", sorted_data);
+            printSortVector("Top 3 (streamed): ", streamTopK(data.begin(), data.end(), 3, true));
+            printSortVector("Bottom 3 (streamed): ", streamTopK(data.begin(), data.end(), 3, false));
+            selectionBenchmark();
+        } else if (choice == 15) {
+            stringSortDemo();
+        } else if (choice == 16) {
+            SortStats stats = introSortCounted(sorted_data);
+            printSortVector("Intro Sorted: ", sorted_data);
+            std::cout << "Comparisons: " << stats.comparisons << ", moves: " << stats.moves
+                      << ", max depth: " << stats.maxDepth << "\n";
+            operationCountsDemo();
         }
     }
 }
\ No newline at end of file
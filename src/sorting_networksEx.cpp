@@ -0,0 +1,299 @@
+#include <algorithm> // For std::copy, std::fill
+#include <limits>    // For std::numeric_limits
+#include "cpu_featuresEx.h"
+#include "sorting_networksEx.h"
+
+// --- SIMD Sorting Networks ---
+//
+// A sorting network is a fixed sequence of compare-exchange steps that does
+// not depend on the data, so it has no branches to mispredict. With SIMD,
+// one min + one max instruction performs 8 (AVX2) or 4 (SSE4.1)
+// compare-exchanges at once.
+//
+// Inputs shorter than a kernel are padded with INT_MAX, which sorts to the end
+// and is dropped when the result is copied back.
+
+const int SORT_PAD = std::numeric_limits<int>::max();
+
+/**
+ * @brief Scalar fallback: plain insertion sort.
+ */
+static void insertionSortSmall(int* a, size_t n) {
+    for (size_t i = 1; i < n; ++i) {
+        int value = a[i];
+        size_t j = i;
+        while (j > 0 && a[j - 1] > value) {
+            a[j] = a[j - 1];
+            --j;
+        }
+        a[j] = value;
+    }
+}
+
+#if SIMD_X86
+
+// ===================== AVX2: 8 ints per register =====================
+
+TARGET_AVX2 static inline void cmpSwap8(__m256i& a, __m256i& b) {
+    __m256i lo = _mm256_min_epi32(a, b);
+    b = _mm256_max_epi32(a, b);
+    a = lo;
+}
+
+TARGET_AVX2 static inline __m256i reverse8(__m256i x) {
+    return _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+/**
+ * @brief Sorts a bitonic register with half-cleaners at lane distance 4, 2, 1.
+ */
+TARGET_AVX2 static inline __m256i bitonicClean8(__m256i x) {
+    __m256i t = _mm256_permute2x128_si256(x, x, 0x01);   // t[i] = x[i ^ 4]
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xF0);
+    t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)); // t[i] = x[i ^ 2]
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xCC);
+    t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)); // t[i] = x[i ^ 1]
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xAA);
+    return x;
+}
+
+/**
+ * @brief 8-int kernel: sorts the lanes of one register.
+ * Sorted pairs are merged into quads, quads into the full register, each merge
+ * comparing lane i with its mirror and then cleaning the halves.
+ */
+TARGET_AVX2 static inline __m256i sortRegister8(__m256i x) {
+    __m256i t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xAA);
+
+    t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(0, 1, 2, 3));  // mirror within each quad
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xCC);
+    t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xAA);
+
+    t = reverse8(x);                                        // mirror across the register
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xF0);
+    t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xCC);
+    t = _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xAA);
+    return x;
+}
+
+/**
+ * @brief Bitonic merge of r[0..count/2) and r[count/2..count), both sorted.
+ * Reversing the second run makes the whole sequence bitonic; then half-cleaners
+ * run across registers (distance count/2 .. 1) and inside each register.
+ */
+TARGET_AVX2 static inline void bitonicMerge8(__m256i* r, int count) {
+    int half = count / 2;
+    for (int i = 0; i < half / 2; ++i) {
+        std::swap(r[half + i], r[count - 1 - i]);
+    }
+    for (int i = half; i < count; ++i) {
+        r[i] = reverse8(r[i]);
+    }
+    for (int stride = half; stride >= 1; stride /= 2) {
+        for (int i = 0; i < count; ++i) {
+            if ((i & stride) == 0) cmpSwap8(r[i], r[i + stride]);
+        }
+    }
+    for (int i = 0; i < count; ++i) {
+        r[i] = bitonicClean8(r[i]);
+    }
+}
+
+TARGET_AVX2 static inline void transpose8x8(__m256i* r) {
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+/**
+ * @brief 64-int kernel: an optimal 19-comparator network sorts the 8 columns,
+ * a transpose turns them into 8 sorted registers, and three rounds of
+ * bitonic merges combine them (8 -> 16 -> 32 -> 64).
+ */
+TARGET_AVX2 static inline void sortRegisters64(__m256i* r) {
+    cmpSwap8(r[0], r[2]); cmpSwap8(r[1], r[3]); cmpSwap8(r[4], r[6]); cmpSwap8(r[5], r[7]);
+    cmpSwap8(r[0], r[4]); cmpSwap8(r[1], r[5]); cmpSwap8(r[2], r[6]); cmpSwap8(r[3], r[7]);
+    cmpSwap8(r[0], r[1]); cmpSwap8(r[2], r[3]); cmpSwap8(r[4], r[5]); cmpSwap8(r[6], r[7]);
+    cmpSwap8(r[2], r[4]); cmpSwap8(r[3], r[5]);
+    cmpSwap8(r[1], r[4]); cmpSwap8(r[3], r[6]);
+    cmpSwap8(r[1], r[2]); cmpSwap8(r[3], r[4]); cmpSwap8(r[5], r[6]);
+    transpose8x8(r);
+
+    bitonicMerge8(r + 0, 2);
+    bitonicMerge8(r + 2, 2);
+    bitonicMerge8(r + 4, 2);
+    bitonicMerge8(r + 6, 2);
+    bitonicMerge8(r + 0, 4);
+    bitonicMerge8(r + 4, 4);
+    bitonicMerge8(r, 8);
+}
+
+TARGET_AVX2 static void sortNetworkAVX2(int* a, size_t n) {
+    alignas(32) int buf[64];
+    // Pick the smallest kernel (8, 16, 32 or 64 ints) that holds n elements.
+    int regs = n <= 8 ? 1 : n <= 16 ? 2 : n <= 32 ? 4 : 8;
+    std::copy(a, a + n, buf);
+    std::fill(buf + n, buf + regs * 8, SORT_PAD);
+
+    __m256i r[8];
+    for (int i = 0; i < regs; ++i) {
+        r[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(buf + 8 * i));
+    }
+
+    if (regs == 8) {
+        sortRegisters64(r);
+    } else {
+        for (int i = 0; i < regs; ++i) {
+            r[i] = sortRegister8(r[i]);
+        }
+        for (int width = 2; width <= regs; width *= 2) {
+            for (int i = 0; i < regs; i += width) {
+                bitonicMerge8(r + i, width);
+            }
+        }
+    }
+
+    for (int i = 0; i < regs; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(buf + 8 * i), r[i]);
+    }
+    std::copy(buf, buf + n, a);
+}
+
+// ===================== SSE4.1: 4 ints per register =====================
+
+TARGET_SSE41 static inline void cmpSwap4(__m128i& a, __m128i& b) {
+    __m128i lo = _mm_min_epi32(a, b);
+    b = _mm_max_epi32(a, b);
+    a = lo;
+}
+
+/**
+ * @brief Sorts a bitonic register with half-cleaners at lane distance 2, 1.
+ * _mm_blend_epi16 selects 16-bit halves: 0xF0 = lanes 2,3; 0xCC = lanes 1,3.
+ */
+TARGET_SSE41 static inline __m128i bitonicClean4(__m128i x) {
+    __m128i t = _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+    x = _mm_blend_epi16(_mm_min_epi32(x, t), _mm_max_epi32(x, t), 0xF0);
+    t = _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_blend_epi16(_mm_min_epi32(x, t), _mm_max_epi32(x, t), 0xCC);
+    return x;
+}
+
+TARGET_SSE41 static inline void bitonicMerge4(__m128i* r, int count) {
+    int half = count / 2;
+    for (int i = 0; i < half / 2; ++i) {
+        std::swap(r[half + i], r[count - 1 - i]);
+    }
+    for (int i = half; i < count; ++i) {
+        r[i] = _mm_shuffle_epi32(r[i], _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    for (int stride = half; stride >= 1; stride /= 2) {
+        for (int i = 0; i < count; ++i) {
+            if ((i & stride) == 0) cmpSwap4(r[i], r[i + stride]);
+        }
+    }
+    for (int i = 0; i < count; ++i) {
+        r[i] = bitonicClean4(r[i]);
+    }
+}
+
+/**
+ * @brief 16-int kernel: 5-comparator network on the 4 columns, transpose,
+ * then bitonic merges 4 -> 8 -> 16.
+ */
+TARGET_SSE41 static void sortNetworkSSE41(int* a, size_t n) {
+    alignas(16) int buf[16];
+    std::copy(a, a + n, buf);
+    std::fill(buf + n, buf + 16, SORT_PAD);
+
+    __m128i r[4];
+    for (int i = 0; i < 4; ++i) {
+        r[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(buf + 4 * i));
+    }
+
+    cmpSwap4(r[0], r[1]); cmpSwap4(r[2], r[3]);
+    cmpSwap4(r[0], r[2]); cmpSwap4(r[1], r[3]);
+    cmpSwap4(r[1], r[2]);
+
+    __m128 f0 = _mm_castsi128_ps(r[0]), f1 = _mm_castsi128_ps(r[1]);
+    __m128 f2 = _mm_castsi128_ps(r[2]), f3 = _mm_castsi128_ps(r[3]);
+    _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+    r[0] = _mm_castps_si128(f0); r[1] = _mm_castps_si128(f1);
+    r[2] = _mm_castps_si128(f2); r[3] = _mm_castps_si128(f3);
+
+    bitonicMerge4(r + 0, 2);
+    bitonicMerge4(r + 2, 2);
+    bitonicMerge4(r, 4);
+
+    for (int i = 0; i < 4; ++i) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(buf + 4 * i), r[i]);
+    }
+    std::copy(buf, buf + n, a);
+}
+
+#endif // SIMD_X86
+
+// --- Runtime dispatch ---
+
+typedef void (*SortNetworkFunc)(int*, size_t);
+
+struct SortNetworkImpl {
+    SortNetworkFunc sort;
+    size_t limit;
+    const char* name;
+};
+
+static SortNetworkImpl selectSortNetwork() {
+#if SIMD_X86
+    if (cpuHasAVX2()) return {sortNetworkAVX2, 64, "AVX2"};
+    if (cpuHasSSE41()) return {sortNetworkSSE41, 16, "SSE4.1"};
+#endif
+    return {insertionSortSmall, 16, "scalar"};
+}
+
+static const SortNetworkImpl& sortNetworkImpl() {
+    static const SortNetworkImpl impl = selectSortNetwork(); // Detected once, on first use.
+    return impl;
+}
+
+size_t sortNetworkLimit(void) {
+    return sortNetworkImpl().limit;
+}
+
+void sortNetwork(int* first, int* last) {
+    size_t n = static_cast<size_t>(last - first);
+    if (n > 1) {
+        sortNetworkImpl().sort(first, n);
+    }
+}
+
+const char* sortNetworkIsa(void) {
+    return sortNetworkImpl().name;
+}
@@ -9,6 +9,7 @@
 #include "helloEx.h" // for printLine
 #include "taskManagementEx.h"
 #include "json.hpp"  // For nlohmann::json
+#include "text_searchEx.h" // For TaskSearchIndex
 
 using json = nlohmann::json;
 
@@ -45,6 +46,7 @@ static void addTask(std::vector<Task>& tasks, int& nextId, bool save);
 static void viewTasks(const std::vector<Task>& tasks);
 static void markTaskComplete(std::vector<Task>& tasks, bool save);
 static void removeTask(std::vector<Task>& tasks, bool save);
+static void searchTasks(const std::vector<Task>& tasks, TaskSearchIndex& index, bool& indexStale);
 
 
 static void displayTaskMenu() {
@@ -53,7 +55,8 @@ static void displayTaskMenu() {
     std::cout << "2. View Tasks" << std::endl;
     std::cout << "3. Mark Task as Complete" << std::endl;
     std::cout << "4. Remove Task" << std::endl;
-    std::cout << "5. Exit to Main Menu" << std::endl;
+    std::cout << "5. Search Tasks" << std::endl;
+    std::cout << "6. Exit to Main Menu" << std::endl;
     std::cout << "--------------------------" << std::endl;
 }
 
@@ -178,6 +181,25 @@ static void removeTask(std::vector<Task>& tasks, bool save) {
     }
 }
 
+/**
+ * @brief Typo-tolerant search over task titles and descriptions (see TaskSearchIndex).
+ * The index is rebuilt only if tasks were added or removed since the last search.
+ */
+static void searchTasks(const std::vector<Task>& tasks, TaskSearchIndex& index, bool& indexStale) {
+    if (indexStale) {
+        std::vector<std::string> titles, descriptions;
+        for (const auto& task : tasks) {
+            titles.push_back(task.title);
+            descriptions.push_back(task.description);
+        }
+        index = TaskSearchIndex(titles, descriptions);
+        indexStale = false;
+    }
+    std::vector<const Task*> list;
+    for (const auto& task : tasks) list.push_back(&task);
+    searchTasksInteractive(index, list);
+}
+
 /**
  * @brief Main function for task management using vector and struct.
  */
@@ -187,12 +209,14 @@ void taskManagementEx(void) {
     int nextId = 1;
     int choice = 0;
     bool saveToFile = true; // Set to true to enable file persistence
+    TaskSearchIndex searchIndex;
+    bool searchIndexStale = true; // tasks were added or removed since the index was built
 
     if (saveToFile) {
         loadTasksFromFile(tasks, nextId);
     }
 
-    while (choice != 5) {
+    while (choice != 6) {
         displayTaskMenu();
         std::cout << "Enter your choice: ";
         std::cin >> choice;
@@ -210,6 +234,7 @@ void taskManagementEx(void) {
         switch (choice) {
             case 1:
                 addTask(tasks, nextId, saveToFile);
+                searchIndexStale = true;
                 break;
             case 2:
                 viewTasks(tasks);
@@ -219,8 +244,12 @@ void taskManagementEx(void) {
                 break;
             case 4:
                 removeTask(tasks, saveToFile);
+                searchIndexStale = true;
                 break;
             case 5:
+                searchTasks(tasks, searchIndex, searchIndexStale);
+                break;
+            case 6:
                 std::cout << "\nReturning to the main menu." << std::endl;
                 break;
             default:
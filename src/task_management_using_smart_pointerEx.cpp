@@ -8,6 +8,7 @@
 #include "helloEx.h" // for printLine
 #include "task_management_using_smart_pointerEx.h"
 #include "json.hpp"  // For nlohmann::json
+#include "text_searchEx.h" // For TaskSearchIndex
 
 using json = nlohmann::json;
 
@@ -35,6 +36,7 @@ static void addTask(std::vector<std::unique_ptr<Task>>& tasks, int& nextId, bool
 static void viewTasks(const std::vector<std::unique_ptr<Task>>& tasks);
 static void markTaskComplete(std::vector<std::unique_ptr<Task>>& tasks, bool save);
 static void removeTask(std::vector<std::unique_ptr<Task>>& tasks, bool save);
+static void searchTasks(const std::vector<std::unique_ptr<Task>>& tasks, TaskSearchIndex& index, bool& indexStale);
 
 static void displaySmartTaskMenu() {
     printLine("Task Manager Menu (Smart Pointers)");
@@ -42,7 +44,8 @@ static void displaySmartTaskMenu() {
     std::cout << "2. View Tasks" << std::endl;
     std::cout << "3. Mark Task as Complete" << std::endl;
     std::cout << "4. Remove Task" << std::endl;
-    std::cout << "5. Exit to Main Menu" << std::endl;
+    std::cout << "5. Search Tasks" << std::endl;
+    std::cout << "6. Exit to Main Menu" << std::endl;
     std::cout << "------------------------------------" << std::endl;
 }
 
@@ -175,6 +178,25 @@ static void removeTask(std::vector<std::unique_ptr<Task>>& tasks, bool save) {
     }
 }
 
+/**
+ * @brief Typo-tolerant search over task titles and descriptions (see TaskSearchIndex).
+ * The index is rebuilt only if tasks were added or removed since the last search.
+ */
+static void searchTasks(const std::vector<std::unique_ptr<Task>>& tasks, TaskSearchIndex& index, bool& indexStale) {
+    if (indexStale) {
+        std::vector<std::string> titles, descriptions;
+        for (const auto& task_ptr : tasks) {
+            titles.push_back(task_ptr->title);
+            descriptions.push_back(task_ptr->description);
+        }
+        index = TaskSearchIndex(titles, descriptions);
+        indexStale = false;
+    }
+    std::vector<const Task*> list;
+    for (const auto& task_ptr : tasks) list.push_back(task_ptr.get());
+    searchTasksInteractive(index, list);
+}
+
 /**
  * @brief The main function for task management using smart pointers.
  */
@@ -184,12 +206,14 @@ void task_management_using_smart_pointerEx(void) {
     int nextId = 1;
     int choice = 0;
     bool saveToFile = true;
+    TaskSearchIndex searchIndex;
+    bool searchIndexStale = true; // tasks were added or removed since the index was built
 
     if (saveToFile) {
         loadTasksFromFile(tasks, nextId);
     }
 
-    while (choice != 5) {
+    while (choice != 6) {
         displaySmartTaskMenu();
         std::cout << "Enter your choice: ";
         std::cin >> choice;
@@ -203,11 +227,12 @@ void task_management_using_smart_pointerEx(void) {
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
         switch (choice) {
-            case 1: addTask(tasks, nextId, saveToFile); break;
+            case 1: addTask(tasks, nextId, saveToFile); searchIndexStale = true; break;
             case 2: viewTasks(tasks); break;
             case 3: markTaskComplete(tasks, saveToFile); break;
-            case 4: removeTask(tasks, saveToFile); break;
-            case 5: std::cout << "\nReturning to the main menu." << std::endl; break;
+            case 4: removeTask(tasks, saveToFile); searchIndexStale = true; break;
+            case 5: searchTasks(tasks, searchIndex, searchIndexStale); break;
+            case 6: std::cout << "\nReturning to the main menu." << std::endl; break;
             default: std::cout << "\nInvalid choice. Please try again.\n" << std::endl; break;
         }
     }
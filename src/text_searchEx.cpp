@@ -0,0 +1,710 @@
+#include <iostream>
+#include <fstream>    // For streaming files in chunks
+#include <vector>
+#include <string>
+#include <cstring>    // For memcmp, memmove
+#include <algorithm>  // For std::search
+#include <functional> // For std::boyer_moore_horspool_searcher
+#include <queue>      // For the Aho-Corasick BFS
+#include <limits>     // For std::numeric_limits
+#include <chrono>     // For the benchmark
+#include <random>     // For std::mt19937
+#include <iomanip>    // For std::setw (benchmark tables)
+#include "helloEx.h"  // for printLine
+#include "cpu_featuresEx.h"
+#include "text_searchEx.h"
+
+// --- Single-pattern search ---
+//
+// Boyer-Moore-Horspool compares the last byte of the current window first and,
+// on a mismatch, shifts the window by how far that byte is from the end of the
+// pattern - up to the whole pattern length per step.
+// The SIMD filter instead looks at 32 (AVX2) or 16 (SSE4.1) window positions at
+// once: it compares every position's first byte with the pattern's first byte
+// and its last byte with the pattern's last byte. In real text both rarely
+// match together, so memcmp runs on only a handful of candidate windows.
+
+const size_t TEXT_SEARCH_CHUNK_BYTES = size_t(4) << 20; // bytes read from a file at a time
+
+/**
+ * @brief Horspool search over text[from..n); reports offset + start of every match.
+ */
+static void horspoolFindAll(const char* text, size_t n, const std::string& pattern, const size_t* shift,
+                            size_t from, size_t offset, std::vector<size_t>& out) {
+    size_t m = pattern.size();
+    const char* p = pattern.data();
+    for (size_t i = from; i + m <= n;) {
+        unsigned char last = static_cast<unsigned char>(text[i + m - 1]);
+        if (last == static_cast<unsigned char>(p[m - 1]) && std::memcmp(text + i, p, m - 1) == 0) {
+            out.push_back(offset + i);
+        }
+        i += shift[last];
+    }
+}
+
+static void findAllScalar(const char* text, size_t n, const std::string& pattern, const size_t* shift,
+                          size_t offset, std::vector<size_t>& out) {
+    horspoolFindAll(text, n, pattern, shift, 0, offset, out);
+}
+
+#if SIMD_X86
+
+// ===================== AVX2: 32 windows per iteration =====================
+
+TARGET_AVX2 static void findAllAVX2(const char* text, size_t n, const std::string& pattern, const size_t* shift,
+                                    size_t offset, std::vector<size_t>& out) {
+    size_t m = pattern.size();
+    const char* p = pattern.data();
+    __m256i first = _mm256_set1_epi8(p[0]);
+    __m256i last = _mm256_set1_epi8(p[m - 1]);
+    size_t i = 0;
+    for (; i + m - 1 + 32 <= n; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + m - 1));
+        __m256i both = _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(both));
+        while (mask != 0) {
+            size_t candidate = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (m <= 2 || std::memcmp(text + candidate + 1, p + 1, m - 2) == 0) {
+                out.push_back(offset + candidate);
+            }
+            mask &= mask - 1; // clear the lowest set bit
+        }
+    }
+    horspoolFindAll(text, n, pattern, shift, i, offset, out);
+}
+
+// ===================== SSE4.1: 16 windows per iteration =====================
+
+TARGET_SSE41 static void findAllSSE41(const char* text, size_t n, const std::string& pattern, const size_t* shift,
+                                      size_t offset, std::vector<size_t>& out) {
+    size_t m = pattern.size();
+    const char* p = pattern.data();
+    __m128i first = _mm_set1_epi8(p[0]);
+    __m128i last = _mm_set1_epi8(p[m - 1]);
+    size_t i = 0;
+    for (; i + m - 1 + 16 <= n; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + m - 1));
+        __m128i both = _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(both));
+        while (mask != 0) {
+            size_t candidate = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (m <= 2 || std::memcmp(text + candidate + 1, p + 1, m - 2) == 0) {
+                out.push_back(offset + candidate);
+            }
+            mask &= mask - 1;
+        }
+    }
+    horspoolFindAll(text, n, pattern, shift, i, offset, out);
+}
+
+#endif // SIMD_X86
+
+// --- Runtime dispatch ---
+
+using FindAllFn = void (*)(const char*, size_t, const std::string&, const size_t*, size_t, std::vector<size_t>&);
+
+struct TextSearchImpl {
+    FindAllFn findAll;
+    const char* name;
+};
+
+static TextSearchImpl selectTextSearch() {
+#if SIMD_X86
+    if (cpuHasAVX2()) return {findAllAVX2, "AVX2"};
+    if (cpuHasSSE41()) return {findAllSSE41, "SSE4.1"};
+#endif
+    return {findAllScalar, "scalar"};
+}
+
+static const TextSearchImpl& textSearchImpl() {
+    static const TextSearchImpl impl = selectTextSearch(); // Detected once, on first use.
+    return impl;
+}
+
+const char* textSearchIsa(void) {
+    return textSearchImpl().name;
+}
+
+SubstringSearcher::SubstringSearcher(std::string pattern) : pattern(std::move(pattern)) {
+    size_t m = this->pattern.size();
+    for (size_t c = 0; c < 256; ++c) shift[c] = m;
+    for (size_t j = 0; j + 1 < m; ++j) {
+        shift[static_cast<unsigned char>(this->pattern[j])] = m - 1 - j;
+    }
+}
+
+void SubstringSearcher::findAll(std::string_view text, size_t offset, std::vector<size_t>& out) const {
+    if (pattern.empty() || text.size() < pattern.size()) return;
+    textSearchImpl().findAll(text.data(), text.size(), pattern, shift, offset, out);
+}
+
+// --- Multi-pattern search (Aho-Corasick) ---
+//
+// The patterns are stored in a trie. Each state also gets a failure link: the
+// longest proper suffix of its string that is also in the trie. Folding the
+// failure links into the transitions turns the trie into a DFA, so the scan
+// is one table lookup per text byte no matter how many patterns there are.
+
+const uint32_t AC_NO_STATE = std::numeric_limits<uint32_t>::max();
+
+AhoCorasick::AhoCorasick(const std::vector<std::string>& patterns) {
+    // State 0 is the root (the empty string).
+    next.assign(256, AC_NO_STATE);
+    patternsAt.emplace_back();
+    for (size_t index = 0; index < patterns.size(); ++index) {
+        const std::string& pattern = patterns[index];
+        lengths.push_back(pattern.size());
+        if (pattern.empty()) continue; // An empty pattern never matches.
+        uint32_t state = 0;
+        for (unsigned char c : pattern) {
+            if (next[state * 256 + c] == AC_NO_STATE) {
+                next[state * 256 + c] = static_cast<uint32_t>(patternsAt.size());
+                next.resize(next.size() + 256, AC_NO_STATE);
+                patternsAt.emplace_back();
+            }
+            state = next[state * 256 + c];
+        }
+        patternsAt[state].push_back(static_cast<uint32_t>(index));
+    }
+
+    // BFS: a state's failure link is always shallower, so it is finished first.
+    std::vector<uint32_t> failure(patternsAt.size(), 0);
+    dictionaryLink.assign(patternsAt.size(), 0);
+    std::queue<uint32_t> pending;
+    for (size_t c = 0; c < 256; ++c) {
+        uint32_t child = next[c];
+        if (child == AC_NO_STATE) {
+            next[c] = 0;
+        } else {
+            pending.push(child);
+        }
+    }
+    while (!pending.empty()) {
+        uint32_t state = pending.front();
+        pending.pop();
+        for (size_t c = 0; c < 256; ++c) {
+            uint32_t child = next[state * 256 + c];
+            uint32_t fallback = next[failure[state] * 256 + c];
+            if (child == AC_NO_STATE) {
+                next[state * 256 + c] = fallback;
+                continue;
+            }
+            failure[child] = fallback;
+            dictionaryLink[child] = patternsAt[fallback].empty() ? dictionaryLink[fallback] : fallback;
+            pending.push(child);
+        }
+    }
+}
+
+uint32_t AhoCorasick::feed(uint32_t state, std::string_view text, size_t offset, std::vector<Match>& out) const {
+    for (size_t i = 0; i < text.size(); ++i) {
+        state = next[state * 256 + static_cast<unsigned char>(text[i])];
+        // Report every pattern that ends here: this state's own and its suffixes'.
+        for (uint32_t s = patternsAt[state].empty() ? dictionaryLink[state] : state; s != 0; s = dictionaryLink[s]) {
+            for (uint32_t pattern : patternsAt[s]) {
+                out.push_back({offset + i + 1 - lengths[pattern], pattern});
+            }
+        }
+    }
+    return state;
+}
+
+std::vector<AhoCorasick::Match> AhoCorasick::findAll(std::string_view text) const {
+    std::vector<Match> matches;
+    feed(0, text, 0, matches);
+    return matches;
+}
+
+// --- Fuzzy search (Myers bit-vector edit distance + q-gram filter) ---
+//
+// The classic edit-distance table has one cell per (pattern char, text char).
+// Myers' algorithm stores a whole table column as bit-vectors of +1/-1 steps
+// between neighbouring cells, so a column of up to 64 cells is updated with a
+// handful of word operations per text byte.
+// Starting every column at 0 (instead of the text position) lets a match begin
+// anywhere, so the last row holds the best distance of a substring ending here.
+
+const size_t MYERS_MAX_PATTERN = 64; // bits per machine word
+const size_t FUZZY_QGRAM = 3;        // q-gram length of the FuzzyIndex
+
+static inline unsigned char lowerAscii(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : c;
+}
+
+static std::string toLowerAscii(std::string_view s) {
+    std::string lower(s);
+    for (char& c : lower) c = static_cast<char>(lowerAscii(static_cast<unsigned char>(c)));
+    return lower;
+}
+
+/**
+ * @brief Best semi-global edit distance for patterns of up to 64 characters.
+ * Both strings must already be lower-cased.
+ */
+static int myersDistance(std::string_view pattern, std::string_view text) {
+    size_t m = pattern.size();
+    uint64_t peq[256] = {}; // bit i set where pattern[i] == byte
+    for (size_t i = 0; i < m; ++i) {
+        peq[static_cast<unsigned char>(pattern[i])] |= uint64_t(1) << i;
+    }
+    const uint64_t lastRow = uint64_t(1) << (m - 1);
+    uint64_t pv = ~uint64_t(0); // +1 vertical steps: column 0 is 0, 1, 2, ..., m
+    uint64_t mv = 0;            // -1 vertical steps
+    int score = static_cast<int>(m);
+    int best = score;
+    for (unsigned char c : text) {
+        uint64_t eq = peq[c];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv); // +1 horizontal steps
+        uint64_t mh = pv & xh;         // -1 horizontal steps
+        if (ph & lastRow) ++score; else if (mh & lastRow) --score;
+        // No carry-in at row 0: the top row stays 0, which is what lets a
+        // match start at any text position.
+        ph <<= 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+        best = std::min(best, score);
+    }
+    return best;
+}
+
+/**
+ * @brief Same result as myersDistance for longer patterns, with the plain
+ * one-column dynamic program.
+ */
+static int dpDistance(std::string_view pattern, std::string_view text) {
+    size_t m = pattern.size();
+    std::vector<int> column(m + 1);
+    for (size_t i = 0; i <= m; ++i) column[i] = static_cast<int>(i);
+    int best = column[m];
+    for (char c : text) {
+        int diagonal = column[0]; // column[0] stays 0: a match may start anywhere
+        for (size_t i = 1; i <= m; ++i) {
+            int above = column[i];
+            column[i] = std::min({diagonal + (pattern[i - 1] != c), above + 1, column[i - 1] + 1});
+            diagonal = above;
+        }
+        best = std::min(best, column[m]);
+    }
+    return best;
+}
+
+static int lowerDistance(std::string_view lowerPattern, std::string_view lowerText) {
+    if (lowerPattern.empty()) return 0;
+    return lowerPattern.size() <= MYERS_MAX_PATTERN ? myersDistance(lowerPattern, lowerText)
+                                                    : dpDistance(lowerPattern, lowerText);
+}
+
+int fuzzyDistance(std::string_view pattern, std::string_view text) {
+    return lowerDistance(toLowerAscii(pattern), toLowerAscii(text));
+}
+
+static inline uint32_t qgramKey(const char* s) {
+    return (uint32_t(static_cast<unsigned char>(s[0])) << 16) | (uint32_t(static_cast<unsigned char>(s[1])) << 8) |
+           uint32_t(static_cast<unsigned char>(s[2]));
+}
+
+FuzzyIndex::FuzzyIndex(const std::vector<std::string>& documents) {
+    this->documents.reserve(documents.size());
+    for (size_t d = 0; d < documents.size(); ++d) {
+        this->documents.push_back(toLowerAscii(documents[d]));
+        const std::string& doc = this->documents.back();
+        for (size_t i = 0; i + FUZZY_QGRAM <= doc.size(); ++i) {
+            std::vector<uint32_t>& list = postings[qgramKey(doc.data() + i)];
+            if (list.empty() || list.back() != d) list.push_back(static_cast<uint32_t>(d));
+        }
+    }
+}
+
+std::vector<FuzzyIndex::Hit> FuzzyIndex::search(std::string_view pattern, int maxErrors, size_t* verified) const {
+    std::vector<Hit> hits;
+    if (verified) *verified = 0;
+    if (maxErrors < 0) return hits;
+    std::string lower = toLowerAscii(pattern);
+    size_t m = lower.size();
+
+    // Each edit destroys at most q of the pattern's m - q + 1 q-grams.
+    long long threshold = static_cast<long long>(m) - static_cast<long long>(FUZZY_QGRAM) + 1 -
+                          static_cast<long long>(maxErrors) * static_cast<long long>(FUZZY_QGRAM);
+    std::vector<uint32_t> candidates;
+    if (m < FUZZY_QGRAM || threshold <= 0) {
+        // Too short or too many errors allowed for the filter: check everything.
+        candidates.resize(documents.size());
+        for (size_t d = 0; d < documents.size(); ++d) candidates[d] = static_cast<uint32_t>(d);
+    } else {
+        // A q-gram that occurs several times in the pattern counts as often.
+        std::unordered_map<uint32_t, uint32_t> patternGrams;
+        for (size_t i = 0; i + FUZZY_QGRAM <= m; ++i) patternGrams[qgramKey(lower.data() + i)]++;
+
+        std::vector<uint32_t> shared(documents.size(), 0);
+        std::vector<uint32_t> touched;
+        for (const auto& gram : patternGrams) {
+            auto it = postings.find(gram.first);
+            if (it == postings.end()) continue;
+            for (uint32_t d : it->second) {
+                if (shared[d] == 0) touched.push_back(d);
+                shared[d] += gram.second;
+            }
+        }
+        for (uint32_t d : touched) {
+            if (shared[d] >= threshold) candidates.push_back(d);
+        }
+        std::sort(candidates.begin(), candidates.end());
+    }
+
+    for (uint32_t d : candidates) {
+        int distance = lowerDistance(lower, documents[d]);
+        if (distance <= maxErrors) hits.push_back({d, distance});
+    }
+    if (verified) *verified = candidates.size();
+    std::stable_sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) { return a.distance < b.distance; });
+    return hits;
+}
+
+// --- Task search ---
+
+static std::vector<std::string> interleaveFields(const std::vector<std::string>& titles,
+                                                 const std::vector<std::string>& descriptions) {
+    std::vector<std::string> documents;
+    documents.reserve(titles.size() * 2);
+    for (size_t i = 0; i < titles.size(); ++i) {
+        documents.push_back(titles[i]);
+        documents.push_back(i < descriptions.size() ? descriptions[i] : std::string());
+    }
+    return documents;
+}
+
+TaskSearchIndex::TaskSearchIndex(const std::vector<std::string>& titles, const std::vector<std::string>& descriptions)
+    : index(interleaveFields(titles, descriptions)) {}
+
+std::vector<TaskSearchIndex::Hit> TaskSearchIndex::search(std::string_view pattern, int maxErrors) const {
+    // A task may match in both fields; keep its better distance.
+    std::vector<Hit> hits;
+    std::vector<int> best(index.size() / 2, -1);
+    for (const FuzzyIndex::Hit& hit : index.search(pattern, maxErrors)) {
+        int& distance = best[hit.document / 2];
+        if (distance < 0 || hit.distance < distance) distance = hit.distance;
+    }
+    for (size_t task = 0; task < best.size(); ++task) {
+        if (best[task] >= 0) hits.push_back({task, best[task]});
+    }
+    std::stable_sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b) { return a.distance < b.distance; });
+    return hits;
+}
+
+void searchTasksInteractive(const TaskSearchIndex& index, const std::vector<const Task*>& tasks) {
+    std::string text;
+    int typos = 0;
+    std::cout << "Enter search text: ";
+    std::getline(std::cin, text);
+    std::cout << "Allowed typos (0-3): ";
+    std::cin >> typos;
+    if (std::cin.fail() || typos < 0 || typos > 3) {
+        std::cout << "\nInvalid input. Please enter a number between 0 and 3.\n" << std::endl;
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        return;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    std::vector<TaskSearchIndex::Hit> hits = index.search(text, typos);
+    printLine("Search Results");
+    if (hits.empty()) {
+        std::cout << "No matching tasks." << std::endl;
+    }
+    for (const TaskSearchIndex::Hit& hit : hits) {
+        const Task& task = *tasks[hit.task];
+        std::cout << "ID: " << task.id << " [" << (task.completed ? "X" : " ") << "]"
+                  << " | Typos: " << hit.distance
+                  << "\n   Title: " << task.title
+                  << "\n   Desc: " << task.description << std::endl;
+        std::cout << "--------------------------------------------------\n";
+    }
+    std::cout << std::endl;
+}
+
+// --- Streaming over files ---
+
+bool searchFile(const std::string& path, const std::string& pattern, std::vector<size_t>& positions) {
+    std::ifstream inFile(path, std::ios::binary);
+    if (!inFile) {
+        std::cerr << "Error opening file for reading: " << path << std::endl;
+        return false;
+    }
+    SubstringSearcher searcher(pattern);
+    size_t overlap = pattern.empty() ? 0 : pattern.size() - 1;
+
+    // The last pattern.size() - 1 bytes of each chunk are kept in front of the
+    // next one, so a match that spans the boundary is still seen whole. None
+    // is reported twice: a match needs pattern.size() bytes, one more than kept.
+    std::vector<char> buffer(overlap + TEXT_SEARCH_CHUNK_BYTES);
+    size_t kept = 0;
+    size_t fileOffset = 0; // file position of buffer[kept]
+    while (inFile) {
+        inFile.read(buffer.data() + kept, static_cast<std::streamsize>(TEXT_SEARCH_CHUNK_BYTES));
+        size_t got = static_cast<size_t>(inFile.gcount());
+        if (got == 0) break;
+        size_t total = kept + got;
+        searcher.findAll(std::string_view(buffer.data(), total), fileOffset - kept, positions);
+
+        size_t keep = std::min(total, overlap);
+        std::memmove(buffer.data(), buffer.data() + total - keep, keep);
+        kept = keep;
+        fileOffset += got;
+    }
+    if (inFile.bad()) {
+        std::cerr << "Error reading file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool searchFileMulti(const std::string& path, const std::vector<std::string>& patterns,
+                     std::vector<AhoCorasick::Match>& matches) {
+    std::ifstream inFile(path, std::ios::binary);
+    if (!inFile) {
+        std::cerr << "Error opening file for reading: " << path << std::endl;
+        return false;
+    }
+    AhoCorasick automaton(patterns);
+    std::vector<char> buffer(TEXT_SEARCH_CHUNK_BYTES);
+    uint32_t state = 0; // carries partial matches from one chunk to the next
+    size_t fileOffset = 0;
+    while (inFile) {
+        inFile.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        size_t got = static_cast<size_t>(inFile.gcount());
+        if (got == 0) break;
+        state = automaton.feed(state, std::string_view(buffer.data(), got), fileOffset, matches);
+        fileOffset += got;
+    }
+    if (inFile.bad()) {
+        std::cerr << "Error reading file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// --- Example ---
+
+/**
+ * @brief Times the substring searchers and Aho-Corasick on 64 MB of random words.
+ */
+static void textSearchBenchmark() {
+    const size_t textBytes = size_t(64) << 20;
+    std::mt19937 rng(19);
+    std::string text;
+    text.reserve(textBytes + 16);
+    while (text.size() < textBytes) {
+        size_t wordLength = 2 + rng() % 9;
+        for (size_t i = 0; i < wordLength; ++i) text.push_back(static_cast<char>('a' + rng() % 26));
+        text.push_back(' ');
+    }
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(1);
+    std::cout << "\nBenchmark: all occurrences in " << (textBytes >> 20) << " MB of random words (ms), kernel "
+              << textSearchIsa() << "\n";
+    std::cout << "pattern length | string::find | std::search (Horspool) | SubstringSearcher | matches\n";
+    for (size_t length : {4, 8, 16, 64}) {
+        std::string pattern = text.substr(text.size() / 2 + rng() % 1000, length);
+
+        auto start = std::chrono::steady_clock::now();
+        size_t findCount = 0;
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            ++findCount;
+        }
+        double findMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t stdCount = 0;
+        std::boyer_moore_horspool_searcher<std::string::const_iterator> stdSearcher(pattern.begin(), pattern.end());
+        for (auto it = std::search(text.cbegin(), text.cend(), stdSearcher); it != text.cend();
+             it = std::search(it + 1, text.cend(), stdSearcher)) {
+            ++stdCount;
+        }
+        double stdMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        std::vector<size_t> positions;
+        SubstringSearcher(pattern).findAll(text, 0, positions);
+        double simdMs = elapsedMs(start);
+
+        bool ok = findCount == stdCount && findCount == positions.size();
+        std::cout << std::setw(14) << length << " | " << std::setw(12) << findMs << " | " << std::setw(22) << stdMs
+                  << " | " << std::setw(17) << simdMs << " | " << positions.size() << (ok ? "" : " (WRONG)") << "\n";
+    }
+
+    std::cout << "patterns | one SubstringSearcher each | Aho-Corasick | matches\n";
+    for (size_t patternCount : {10, 100}) {
+        std::vector<std::string> patterns;
+        for (size_t i = 0; i < patternCount; ++i) patterns.push_back(text.substr(rng() % textBytes, 6));
+
+        auto start = std::chrono::steady_clock::now();
+        size_t separate = 0;
+        for (const std::string& pattern : patterns) {
+            std::vector<size_t> positions;
+            SubstringSearcher(pattern).findAll(text, 0, positions);
+            separate += positions.size();
+        }
+        double separateMs = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t combined = AhoCorasick(patterns).findAll(text).size();
+        double acMs = elapsedMs(start);
+
+        std::cout << std::setw(8) << patternCount << " | " << std::setw(25) << separateMs << " | " << std::setw(12)
+                  << acMs << " | " << combined << (separate == combined ? "" : " (WRONG)") << "\n";
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+/**
+ * @brief Times fuzzy search over 200,000 generated task titles, with and
+ * without the q-gram filter.
+ */
+static void fuzzySearchBenchmark() {
+    const size_t titleCount = 200000;
+    std::mt19937 rng(20);
+    std::vector<std::string> words;
+    for (size_t w = 0; w < 2000; ++w) {
+        std::string word;
+        size_t length = 4 + rng() % 6;
+        for (size_t i = 0; i < length; ++i) word.push_back(static_cast<char>('a' + rng() % 26));
+        words.push_back(word);
+    }
+    std::vector<std::string> titles;
+    for (size_t t = 0; t < titleCount; ++t) {
+        std::string title = words[rng() % words.size()];
+        size_t wordCount = 2 + rng() % 4;
+        for (size_t w = 1; w < wordCount; ++w) title += " " + words[rng() % words.size()];
+        titles.push_back(title);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    FuzzyIndex index(titles);
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::setfill(' ') << std::fixed << std::setprecision(2);
+    std::cout << "\nBenchmark: fuzzy search over " << titleCount << " titles (index built in " << buildMs
+              << " ms), ms per query\n";
+    std::cout << "typos | scan all (Myers) | q-gram index | verified | hits\n";
+    const size_t queries = 20;
+    for (int typos = 1; typos <= 2; ++typos) {
+        double scanMs = 0, indexMs = 0;
+        size_t verified = 0, hits = 0;
+        bool ok = true;
+        for (size_t q = 0; q < queries; ++q) {
+            // Two words of a real title, with 'typos' random substitutions.
+            const std::string& title = titles[rng() % titleCount];
+            std::string pattern = title.substr(0, title.find(' ', title.find(' ') + 1));
+            for (int e = 0; e < typos; ++e) pattern[rng() % pattern.size()] = static_cast<char>('a' + rng() % 26);
+
+            start = std::chrono::steady_clock::now();
+            size_t scanHits = 0;
+            for (const std::string& t : titles) scanHits += fuzzyDistance(pattern, t) <= typos;
+            scanMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            size_t checked = 0;
+            size_t found = index.search(pattern, typos, &checked).size();
+            indexMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            verified += checked;
+            hits += found;
+            ok = ok && found == scanHits;
+        }
+        std::cout << std::setw(5) << typos << " | " << std::setw(16) << scanMs / queries << " | " << std::setw(12)
+                  << indexMs / queries << " | " << std::setw(8) << verified / queries << " | " << hits / queries
+                  << (ok ? "" : " (WRONG)") << "\n";
+    }
+    std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+/**
+ * @brief Prints each match with the rest of its line, for context.
+ */
+static void printMatchLines(const std::string& path, const std::vector<size_t>& positions, size_t limit) {
+    std::ifstream inFile(path, std::ios::binary);
+    for (size_t i = 0; i < positions.size() && i < limit; ++i) {
+        inFile.clear();
+        inFile.seekg(static_cast<std::streamoff>(positions[i]));
+        std::string line;
+        std::getline(inFile, line);
+        std::cout << "  @" << positions[i] << ": " << line.substr(0, 60) << "\n";
+    }
+    if (positions.size() > limit) std::cout << "  ... " << positions.size() - limit << " more\n";
+}
+
+void text_searchEx(void) {
+    printLine("Text Search Example");
+
+    int choice = 0;
+    while (choice != 5) {
+        std::cout << "\n--- Text Search Menu (" << textSearchIsa() << ") ---\n";
+        std::cout << "1. Find a pattern in a file (e.g. log.txt, tasks.json)\n";
+        std::cout << "2. Find several patterns at once (Aho-Corasick)\n";
+        std::cout << "3. Benchmark: SIMD filter + Horspool vs std::string::find\n";
+        std::cout << "4. Benchmark: fuzzy search (q-gram index + Myers)\n";
+        std::cout << "5. Back to main menu\n";
+        std::cout << "Enter your choice: ";
+        std::cin >> choice;
+
+        if (std::cin.fail() || choice < 1 || choice > 5) {
+            std::cout << "\nInvalid input. Please enter a number between 1 and 5.\n";
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            continue;
+        }
+
+        if (choice == 5) break;
+        if (choice == 3) {
+            textSearchBenchmark();
+            continue;
+        }
+        if (choice == 4) {
+            fuzzySearchBenchmark();
+            continue;
+        }
+
+        std::string path;
+        std::cout << "Enter the file name: ";
+        std::cin >> path;
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        if (choice == 1) {
+            std::string pattern;
+            std::cout << "Enter the pattern: ";
+            std::getline(std::cin, pattern);
+            std::vector<size_t> positions;
+            if (!searchFile(path, pattern, positions)) continue;
+            std::cout << "-> " << positions.size() << " occurrence(s) of \"" << pattern << "\"\n";
+            printMatchLines(path, positions, 10);
+        } else {
+            std::string line;
+            std::cout << "Enter the patterns, separated by spaces: ";
+            std::getline(std::cin, line);
+            std::vector<std::string> patterns;
+            size_t start = 0;
+            while (start < line.size()) {
+                size_t end = line.find(' ', start);
+                if (end == std::string::npos) end = line.size();
+                if (end > start) patterns.push_back(line.substr(start, end - start));
+                start = end + 1;
+            }
+            std::vector<AhoCorasick::Match> matches;
+            if (!searchFileMulti(path, patterns, matches)) continue;
+            for (size_t p = 0; p < patterns.size(); ++p) {
+                size_t count = std::count_if(matches.begin(), matches.end(),
+                                             [p](const AhoCorasick::Match& m) { return m.pattern == p; });
+                std::cout << "-> \"" << patterns[p] << "\": " << count << " occurrence(s)\n";
+            }
+        }
+    }
+}